@@ -56,6 +56,7 @@
 #include <cctype>
 #include <cerrno>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <limits>
 #include <list>
@@ -2715,6 +2716,106 @@ void VerilatedContext::profExecWindow(uint64_t flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_ns.m_profExecWindow = flag;
 }
+static unsigned vl_cpu_limit() {
+    // CPU numbers at or above this can not be pinned to
+#ifdef CPU_SETSIZE
+    return CPU_SETSIZE;
+#else
+    return std::max(1024U, std::thread::hardware_concurrency());
+#endif
+}
+static std::string vl_parse_cpu_list(const std::string& text, std::vector<unsigned>& cpusr) {
+    // Parse Linux cpulist format, e.g. "0-3,8,10-11"; return error message or ""
+    cpusr.clear();
+    const unsigned limit = vl_cpu_limit();
+    const auto parseNumber = [limit](const std::string& str, unsigned& valuer) {
+        if (str.empty()) return false;
+        valuer = 0;
+        for (const char c : str) {
+            if (!std::isdigit(static_cast<unsigned char>(c))) return false;
+            valuer = valuer * 10 + (c - '0');
+            if (valuer >= limit) return false;  // Also stops overflow
+        }
+        return true;
+    };
+    std::stringstream ss{text};
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        while (!range.empty() && std::isspace(range.back())) range.pop_back();
+        while (!range.empty() && std::isspace(range.front())) range.erase(0, 1);
+        const size_t dash = range.find('-');
+        const std::string first = range.substr(0, dash);
+        const std::string last = dash == std::string::npos ? first : range.substr(dash + 1);
+        unsigned lo;
+        unsigned hi;
+        if (!parseNumber(first, lo) || !parseNumber(last, hi)) {
+            return "expected CPU numbers below " + std::to_string(limit)
+                   + " or ranges of them, got '" + range + "'";
+        }
+        if (lo > hi) return "CPU range is reversed: '" + range + "'";
+        for (unsigned cpu = lo; cpu <= hi; ++cpu) cpusr.push_back(cpu);
+    }
+    if (cpusr.empty()) return "no CPUs listed";
+    return "";
+}
+
+void VerilatedContext::threadsCpus(const std::string& cpus) {
+    std::vector<unsigned> cpuList;
+    const std::string err = vl_parse_cpu_list(cpus, cpuList);
+    if (!err.empty()) {
+        const std::string msg = "Cannot parse simulation thread CPU list '" + cpus + "': " + err;
+        VL_FATAL_MT("COMMAND_LINE", 0, "", msg.c_str());
+    }
+    bool poolCreated;
+    {
+        const VerilatedLockGuard lock{m_mutex};
+        poolCreated = static_cast<bool>(m_threadPool);
+        if (!poolCreated) {
+            m_ns.m_threadsCpus = cpus;
+            m_ns.m_threadsCpuList = cpuList;
+        }
+    }
+    if (poolCreated) {
+        VL_FATAL_MT(__FILE__, __LINE__, "",
+                    "%Error: Cannot set simulation thread CPUs after the thread pool has been "
+                    "created.");
+    }
+#if defined(__linux) || defined(CPU_ZERO)  // Linux-like; assume we have pthreads etc
+    // Allocations by this thread from now on (e.g. the model) are then local to these CPUs
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (const unsigned cpu : cpuList) CPU_SET(cpu, &cpuset);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+#endif
+}
+std::string VerilatedContext::threadsCpus() const VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    return m_ns.m_threadsCpus;
+}
+std::vector<unsigned> VerilatedContext::threadsCpuList() const VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    return m_ns.m_threadsCpuList;
+}
+void VerilatedContext::threadsNumaNode(unsigned node) {
+    const std::string filename
+        = "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist";
+    std::ifstream is{filename};
+    std::string cpus;
+    if (!is || !std::getline(is, cpus)) {
+        const std::string msg = "Cannot read CPUs of NUMA node " + std::to_string(node) + " from "
+                                + filename;
+        VL_FATAL_MT("COMMAND_LINE", 0, "", msg.c_str());
+    }
+    threadsCpus(cpus);
+}
+void VerilatedContext::threadsSpinBudget(uint32_t n) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_threadsSpinBudget = n;
+}
+void VerilatedContext::threadsWarmup(uint32_t n) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_threadsWarmup = n;
+}
 void VerilatedContext::profExecFilename(const std::string& flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_ns.m_profExecFilename = flag;
@@ -2964,6 +3065,17 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
         } else if (commandArgVlUint64(arg, "+verilator+seed+", u64, 1,
                                       std::numeric_limits<int>::max())) {
             randSeed(static_cast<int>(u64));
+        } else if (commandArgVlString(arg, "+verilator+threads+cpus+", str)) {
+            threadsCpus(str);
+        } else if (commandArgVlUint64(arg, "+verilator+threads+numa+", u64, 0,
+                                      std::numeric_limits<unsigned>::max())) {
+            threadsNumaNode(static_cast<unsigned>(u64));
+        } else if (commandArgVlUint64(arg, "+verilator+threads+spin+budget+", u64, 0,
+                                      std::numeric_limits<uint32_t>::max())) {
+            threadsSpinBudget(static_cast<uint32_t>(u64));
+        } else if (commandArgVlUint64(arg, "+verilator+threads+warmup+", u64, 0,
+                                      std::numeric_limits<uint32_t>::max())) {
+            threadsWarmup(static_cast<uint32_t>(u64));
         } else if (arg == "+verilator+V") {
             VerilatedImp::versionDump();  // Someday more info too
             VL_FATAL_MT("COMMAND_LINE", 0, "",
@@ -3091,6 +3203,8 @@ void VerilatedContextImp::scopeErase(const VerilatedScope* scopep) VL_MT_SAFE {
     VerilatedImp::userEraseScope(scopep);
     const auto it = m_impdatap->m_nameMap.find(scopep->name());
     if (it != m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.erase(it);
+    m_impdatap->m_nameGeneration.store(VerilatedContextImpData::newNameGeneration(),
+                                       std::memory_order_release);
 }
 const VerilatedScope* VerilatedContext::scopeFind(const char* namep) const VL_MT_SAFE {
     // Thread save only assuming this is called only after model construction completed
@@ -308,6 +308,10 @@ public:
     virtual const char* modelName() const = 0;
     /// Returns the thread level parallelism, this model was Verilated with. Always 1 or higher.
     virtual unsigned threads() const = 0;
+    /// Prepare for cloning the model at the process level (e.g. fork in Linux)
+    virtual void prepareClone() const {}
+    /// Re-init after cloning the model at the process level (e.g. fork in Linux)
+    virtual void atClone() const {}
 
 private:
     // The following are for use by Verilator internals only
@@ -429,11 +433,15 @@ protected:
         // Fast path
         uint64_t m_profExecStart = 1;  // +prof+exec+start time
         uint32_t m_profExecWindow = 2;  // +prof+exec+window size
+        uint32_t m_threadsSpinBudget = VL_LOCK_SPINS;  // +threads+spin+budget spins
+        uint32_t m_threadsWarmup = 1000;  // +threads+warmup evaluations
         // Slow path
         std::string m_coverageFilename;  // +coverage+file filename
         std::string m_profExecFilename;  // +prof+exec+file filename
         std::string m_profVltFilename;  // +prof+vlt filename
         std::string m_solverProgram;  // SMT solver program
+        std::string m_threadsCpus;  // +threads+cpus list as given, empty for automatic
+        std::vector<unsigned> m_threadsCpuList;  // Parsed m_threadsCpus
         VlOs::DeltaCpuTime m_cpuTimeStart{false};  // CPU time, starts when create first model
         VlOs::DeltaWallTime m_wallTimeStart{false};  // Wall time, starts when create first model
         std::vector<traceBaseModelCb_t> m_traceBaseModelCbs;  // Callbacks to traceRegisterModel
@@ -617,6 +625,26 @@ public:
     /// Set number of threads used for simulation (including the main thread)
     /// Can only be called before the thread pool is created (before first model is added).
     void threads(unsigned n);
+    /// Get list of CPUs simulation threads are pinned to, empty if automatically assigned
+    std::string threadsCpus() const VL_MT_SAFE;
+    /// Pin simulation threads to a CPU list, e.g. "0-7,16-23".  The main thread
+    /// uses the first CPU, worker threads the following CPUs round-robin.  Also
+    /// pins the calling thread to the whole list, so model memory it
+    /// allocates afterwards is first-touched local to those CPUs.
+    /// Can only be called before the thread pool is created (before first model is added).
+    void threadsCpus(const std::string& cpus);
+    /// Pin simulation threads to the CPUs of a NUMA node, as with threadsCpus()
+    void threadsNumaNode(unsigned node);
+    /// Get number of spins a simulation thread waits for another thread before sleeping
+    uint32_t threadsSpinBudget() const VL_MT_SAFE { return m_ns.m_threadsSpinBudget; }
+    /// Set number of spins a simulation thread waits for another thread before sleeping.
+    /// Lower values use less CPU when threads are idle, higher values have lower latency.
+    void threadsSpinBudget(uint32_t n) VL_MT_SAFE;
+    /// Get number of evaluations measured before selecting a --threads-alternatives schedule
+    uint32_t threadsWarmup() const VL_MT_SAFE { return m_ns.m_threadsWarmup; }
+    /// Set number of evaluations measured before selecting a --threads-alternatives schedule.
+    /// Zero disables selection. Only affects models not yet evaluated.
+    void threadsWarmup(uint32_t n) VL_MT_SAFE;
 
     /// Trace signals in models within the context; called by application code
     void trace(VerilatedTraceBaseC* tfp, int levels, int options = 0);
@@ -670,6 +698,9 @@ public:
     std::string profVltFilename() const VL_MT_SAFE;
     void profVltFilename(const std::string& flag) VL_MT_SAFE;
 
+    // Internal: CPUs to pin simulation threads to, empty for automatic
+    std::vector<unsigned> threadsCpuList() const VL_MT_SAFE;
+
     // Internal: SMT solver program
     std::string solverProgram() const VL_MT_SAFE;
     void solverProgram(const std::string& flag) VL_MT_SAFE;
@@ -31,7 +31,9 @@
 #include <deque>
 #include <fstream>
 #include <map>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 //=============================================================================
 // VerilatedCovConst
@@ -90,6 +92,36 @@ public:
     ~VerilatedCoverItemSpec() override = default;
 };
 
+//=============================================================================
+// VerilatedCoverItemShards
+// Coverage item counted in several shards of counters, e.g. one per thread.
+
+class VerilatedCoverItemShards final : public VerilatedCovImpItem {
+private:
+    // MEMBERS
+    uint32_t* m_countp;  // Count value in first shard
+    size_t m_shards;  // Number of shards
+    size_t m_stride;  // Distance between shards' counters
+public:
+    // METHODS
+    uint64_t count() const override {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < m_shards; ++i) sum += m_countp[i * m_stride];
+        return sum;
+    }
+    void zero() const override {
+        for (size_t i = 0; i < m_shards; ++i) m_countp[i * m_stride] = 0;
+    }
+    // CONSTRUCTORS
+    VerilatedCoverItemShards(uint32_t* countp, size_t shards, size_t stride)
+        : m_countp{countp}
+        , m_shards{shards}
+        , m_stride{stride} {
+        zero();
+    }
+    ~VerilatedCoverItemShards() override = default;
+};
+
 //=============================================================================
 // VerilatedCovImp
 //
@@ -103,6 +135,7 @@ private:
     // TYPES
     using ValueIndexMap = std::map<const std::string, int>;
     using IndexValueMap = std::map<int, std::string>;
+    using EventCounts = std::map<const std::string, std::pair<std::string, uint64_t>>;
     using ItemList = std::deque<VerilatedCovImpItem*>;
 
     // MEMBERS
@@ -357,21 +390,9 @@ public:
         m_insertp = nullptr;
     }
 
-    void write(const std::string& filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
-        Verilated::quiesce();
-        const VerilatedLockGuard lock{m_mutex};
-        selftest();
-
-        std::ofstream os{filename};
-        if (os.fail()) {
-            const std::string msg = "%Error: Can't write '"s + filename + "'";
-            VL_FATAL_MT("", 0, "", msg.c_str());
-            return;
-        }
-        os << "# SystemC::Coverage-3\n";
-
-        // Build list of events; totalize if collapsing hierarchy
-        std::map<const std::string, std::pair<std::string, uint64_t>> eventCounts;
+    // Build list of events; totalize if collapsing hierarchy
+    EventCounts eventCounts() VL_REQUIRES(m_mutex) {
+        EventCounts eventCounts;
         for (const auto& itemp : m_items) {
             std::string name;
             std::string hier;
@@ -418,9 +439,24 @@ public:
                 eventCounts.emplace(name, std::make_pair(hier, itemp->count()));
             }
         }
+        return eventCounts;
+    }
+
+    void write(const std::string& filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        Verilated::quiesce();
+        const VerilatedLockGuard lock{m_mutex};
+        selftest();
+
+        std::ofstream os{filename};
+        if (os.fail()) {
+            const std::string msg = "%Error: Can't write '"s + filename + "'";
+            VL_FATAL_MT("", 0, "", msg.c_str());
+            return;
+        }
+        os << "# SystemC::Coverage-3\n";
 
         // Output body
-        for (const auto& i : eventCounts) {
+        for (const auto& i : eventCounts()) {
             os << "C '" << std::dec;
             os << i.first;
             if (!i.second.first.empty()) os << keyValueFormatter(VL_CIK_HIER, i.second.first);
@@ -428,6 +464,28 @@ public:
             os << '\n';
         }
     }
+
+    void writeBinary(const std::string& filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        Verilated::quiesce();
+        const VerilatedLockGuard lock{m_mutex};
+        selftest();
+
+        std::ofstream os{filename, std::ios::binary};
+        if (os.fail()) {
+            const std::string msg = "%Error: Can't write '"s + filename + "'";
+            VL_FATAL_MT("", 0, "", msg.c_str());
+            return;
+        }
+        VerilatedCovBinaryWriter writer;
+        for (const auto& i : eventCounts()) {
+            writer.addPoint(i.first,
+                            i.second.first.empty()
+                                ? std::string{}
+                                : keyValueFormatter(VL_CIK_HIER, i.second.first),
+                            i.second.second);
+        }
+        writer.write(os);
+    }
 };
 
 //=============================================================================
@@ -445,12 +503,18 @@ void VerilatedCovContext::zero() VL_MT_SAFE { impp()->zero(); }
 void VerilatedCovContext::write(const std::string& filename) VL_MT_SAFE {
     impp()->write(filename);
 }
+void VerilatedCovContext::writeBinary(const std::string& filename) VL_MT_SAFE {
+    impp()->writeBinary(filename);
+}
 void VerilatedCovContext::_inserti(uint32_t* itemp) VL_MT_SAFE {
     impp()->inserti(new VerilatedCoverItemSpec<uint32_t>{itemp});
 }
 void VerilatedCovContext::_inserti(uint64_t* itemp) VL_MT_SAFE {
     impp()->inserti(new VerilatedCoverItemSpec<uint64_t>{itemp});
 }
+void VerilatedCovContext::_inserti(uint32_t* itemp, size_t shards, size_t stride) VL_MT_SAFE {
+    impp()->inserti(new VerilatedCoverItemShards{itemp, shards, stride});
+}
 void VerilatedCovContext::_insertf(const char* filename, int lineno) VL_MT_SAFE {
     impp()->insertf(filename, lineno);
 }
@@ -75,6 +75,16 @@ class VerilatedCovImp;
         ccontextp->_insertp("hier", name, __VA_ARGS__); \
     } while (false)
 
+/// Insert a coverage item whose count is the sum of 'shards' counters,
+/// starting at countp, each 'stride' counters apart.
+#define VL_COVER_INSERT_SHARDS(covcontextp, name, countp, shards, stride, ...) \
+    do { \
+        auto const ccontextp = covcontextp; \
+        ccontextp->_inserti(countp, shards, stride); \
+        ccontextp->_insertf(__FILE__, __LINE__); \
+        ccontextp->_insertp("hier", name, __VA_ARGS__); \
+    } while (false)
+
 //=============================================================================
 //  VerilatedCov
 /// Per-VerilatedContext coverage data class.
@@ -95,6 +105,9 @@ public:
     /// Write all coverage data to a file
     void write() VL_MT_SAFE { write(defaultFilename()); }
     void write(const std::string& filename) VL_MT_SAFE;
+    /// Write all coverage data to a file in the binary format, which
+    /// verilator_coverage reads and merges faster than the text format
+    void writeBinary(const std::string& filename) VL_MT_SAFE;
     /// Clear coverage points (and call delete on all items)
     void clear() VL_MT_SAFE;
     /// Clear items not matching the provided string
@@ -111,6 +124,7 @@ public:
     // _insert1: Remember item pointer with count.  (Not const, as may add zeroing function)
     void _inserti(uint32_t* itemp) VL_MT_SAFE;
     void _inserti(uint64_t* itemp) VL_MT_SAFE;
+    void _inserti(uint32_t* itemp, size_t shards, size_t stride) VL_MT_SAFE;
     // _insert2: Set default filename and line number
     void _insertf(const char* filename, int lineno) VL_MT_SAFE;
     // _insert3: Set parameters
@@ -24,7 +24,10 @@
 
 #include "verilatedos.h"
 
+#include <ostream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 //=============================================================================
 // Data used to edit below file, using vlcovgen
@@ -82,4 +85,86 @@ public:
     }
 };
 
+//=============================================================================
+// VerilatedCovBinary
+// Binary coverage file format, written by VerilatedCovContext::writeBinary
+// and read by verilator_coverage.  All numbers are in the writer's byte
+// order, which readers check against ENDIAN_MARK.
+//
+//   magic()                 MAGIC_SIZE bytes
+//   uint32_t VERSION, ENDIAN_MARK
+//   uint64_t                Bytes in layout section
+//   Layout section, the same in every file written by the same model:
+//     uint64_t              Number of strings
+//     Each string:          uint32_t length, then characters
+//     uint64_t              Number of points
+//     Each point:           uint32_t index of name string,
+//                           uint32_t index of hier string or NO_STRING
+//   Counts section:         uint64_t count of each point, in the same order
+//
+// A point's name in the text format is its name string followed by its
+// hier string.
+
+class VerilatedCovBinary final {
+public:
+    static const char* magic() VL_PURE { return "VLCOVBIN"; }
+    static constexpr size_t MAGIC_SIZE = 8;
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t ENDIAN_MARK = 0x01020304;
+    static constexpr uint32_t NO_STRING = ~0U;  // Point has no hier string
+};
+
+//=============================================================================
+// VerilatedCovBinaryWriter
+// Writes a VerilatedCovBinary file, shared by the runtime and verilator_coverage
+
+class VerilatedCovBinaryWriter final {
+    // MEMBERS
+    std::unordered_map<std::string, uint32_t> m_stringIndexes;  // Index of each string
+    std::vector<const std::string*> m_strings;  // Strings, in index order
+    std::vector<uint32_t> m_pointStrings;  // Name and hier string index of each point
+    std::vector<uint64_t> m_counts;  // Count of each point
+
+    // METHODS
+    uint32_t stringIndex(const std::string& str) {
+        const auto pair = m_stringIndexes.emplace(str, static_cast<uint32_t>(m_strings.size()));
+        if (pair.second) m_strings.push_back(&pair.first->first);
+        return pair.first->second;
+    }
+
+public:
+    // Add a point; hier is the hierarchy key and value, or empty if none, and
+    // is shared between points, so should not also be part of name
+    void addPoint(const std::string& name, const std::string& hier, uint64_t count) {
+        m_pointStrings.push_back(stringIndex(name));
+        m_pointStrings.push_back(hier.empty() ? VerilatedCovBinary::NO_STRING : stringIndex(hier));
+        m_counts.push_back(count);
+    }
+    // Write the file's contents
+    void write(std::ostream& os) const {
+        std::string layout;
+        const auto put = [&layout](const void* datap, size_t size) {
+            layout.append(static_cast<const char*>(datap), size);
+        };
+        const uint64_t numStrings = m_strings.size();
+        put(&numStrings, sizeof(numStrings));
+        for (const std::string* const strp : m_strings) {
+            const uint32_t len = static_cast<uint32_t>(strp->size());
+            put(&len, sizeof(len));
+            put(strp->data(), len);
+        }
+        const uint64_t numPoints = m_counts.size();
+        put(&numPoints, sizeof(numPoints));
+        put(m_pointStrings.data(), m_pointStrings.size() * sizeof(uint32_t));
+
+        const uint32_t header[2] = {VerilatedCovBinary::VERSION, VerilatedCovBinary::ENDIAN_MARK};
+        const uint64_t layoutSize = layout.size();
+        os.write(VerilatedCovBinary::magic(), VerilatedCovBinary::MAGIC_SIZE);
+        os.write(reinterpret_cast<const char*>(header), sizeof(header));
+        os.write(reinterpret_cast<const char*>(&layoutSize), sizeof(layoutSize));
+        os.write(layout.data(), layout.size());
+        os.write(reinterpret_cast<const char*>(m_counts.data()), m_counts.size() * sizeof(uint64_t));
+    }
+};
+
 #endif  // guard
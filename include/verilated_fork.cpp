@@ -0,0 +1,111 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated process fork server implementation code
+///
+/// This file must be compiled and linked against all Verilated objects
+/// that use VerilatedForkServer.
+///
+//=============================================================================
+
+#define VERILATOR_VERILATED_FORK_CPP_
+
+#include "verilatedos.h"
+
+#include "verilated_fork.h"
+
+#include "verilated_trace.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+//=============================================================================
+// VerilatedForkServer
+
+bool VerilatedForkServer::fork(unsigned child) VL_MT_UNSAFE {
+    while (m_maxChildren && m_children.size() >= m_maxChildren) {
+        if (!waitOne()) break;
+    }
+
+    // Nothing may be left buffered, else both processes would write it
+    for (const auto& pair : m_traces) {
+        if (pair.first->isOpen()) pair.first->close();
+    }
+    Verilated::runFlushCallbacks();
+
+    for (const VerilatedModel* const modelp : m_models) modelp->prepareClone();
+    const pid_t pid = ::fork();
+    for (const VerilatedModel* const modelp : m_models) modelp->atClone();
+
+    if (VL_UNLIKELY(pid < 0)) {
+        const std::string msg = std::string{"fork failed: "} + std::strerror(errno);
+        VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+        return false;
+    }
+    if (pid > 0) {
+        m_children.push_back(pid);
+        return false;
+    }
+
+    // Child
+    m_children.clear();
+    m_failures = 0;
+    if (m_coverageZero) {
+        m_coverageZero();
+        m_contextp->coverageFilename(childFilename(m_contextp->coverageFilename(), child));
+    }
+    for (const auto& pair : m_traces) {
+        pair.first->open(childFilename(pair.second, child).c_str());
+    }
+    return true;
+}
+
+bool VerilatedForkServer::waitOne() VL_MT_UNSAFE {
+    // Wait for the oldest child of this server to finish, return false if none.
+    // Only our children are waited for, as waitpid(-1) would reap, and so
+    // lose the status of, children the user is waiting for themselves.
+    if (m_children.empty()) return false;
+    int status = 0;
+    pid_t pid;
+    do {
+        pid = ::waitpid(m_children.front(), &status, 0);
+    } while (pid < 0 && errno == EINTR);
+    m_children.erase(m_children.begin());
+    // pid < 0 when already reaped elsewhere, e.g. by a signal handler
+    if (pid > 0 && (!WIFEXITED(status) || WEXITSTATUS(status) != 0)) ++m_failures;
+    return true;
+}
+
+unsigned VerilatedForkServer::wait() VL_MT_UNSAFE {
+    while (waitOne()) {}
+    const unsigned failures = m_failures;
+    m_failures = 0;
+    return failures;
+}
+
+std::string VerilatedForkServer::childFilename(const std::string& filename,
+                                               unsigned child) VL_PURE {
+    const std::string suffix = "_" + std::to_string(child);
+    const size_t slash = filename.rfind('/');
+    const size_t dot = filename.rfind('.');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash) || dot == 0
+        || (slash != std::string::npos && dot == slash + 1)) {
+        return filename + suffix;
+    }
+    return filename.substr(0, dot) + suffix + filename.substr(dot);
+}
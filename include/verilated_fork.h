@@ -0,0 +1,104 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated process fork server header
+///
+/// This must be included in user wrapper code that wants to run a common
+/// warm-up (e.g. reset and boot) once, then fork copy-on-write child
+/// processes that each continue it differently.
+///
+/// Only supported on POSIX systems.
+///
+//=============================================================================
+
+#ifndef VERILATOR_VERILATED_FORK_H_
+#define VERILATOR_VERILATED_FORK_H_
+
+#include "verilatedos.h"
+
+#include "verilated.h"
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sys/types.h>
+
+//=============================================================================
+// VerilatedForkServer
+/// Forks child processes from the current state of the models under a
+/// VerilatedContext.
+///
+/// Around each fork, the registered models release and re-create their
+/// thread pools (see prepareClone/atClone), as only the forking thread
+/// exists in the child.  Registered trace files are closed before the
+/// first fork, and re-opened in each child under a per-child filename.
+/// They stay closed in the parent, so its files hold the warm-up only.
+/// When coverage is registered, each child zeros its coverage counts and
+/// writes to a per-child filename, so merging the parent's and children's
+/// coverage counts the warm-up only once.
+///
+/// This class is not thread safe, it must be called by the main thread
+
+class VerilatedForkServer final {
+    // MEMBERS
+    VerilatedContext* const m_contextp;  // Context being forked
+    std::vector<const VerilatedModel*> m_models;  // Models to clone
+    std::vector<std::pair<VerilatedTraceBaseC*, std::string>> m_traces;  // Trace, filename
+    std::function<void()> m_coverageZero;  // Zero coverage counts, when coverage registered
+    std::vector<pid_t> m_children;  // Children still running
+    unsigned m_maxChildren = 0;  // Maximum children running at once, 0 = unlimited
+    unsigned m_failures = 0;  // Children that exited with an error
+
+    // METHODS
+    bool waitOne() VL_MT_UNSAFE;
+
+public:
+    // CONSTRUCTORS
+    explicit VerilatedForkServer(VerilatedContext* contextp)
+        : m_contextp{contextp} {}
+    /// Destruct, waiting for all children to finish
+    ~VerilatedForkServer() { wait(); }
+    VL_UNCOPYABLE(VerilatedForkServer);
+
+    // METHODS
+    /// Add a model to clone into each child; all models must be under
+    /// this server's context
+    void addModel(const VerilatedModel* modelp) VL_MT_UNSAFE { m_models.push_back(modelp); }
+    /// Add a trace to re-open in each child, as childFilename(filename)
+    void addTrace(VerilatedTraceBaseC* tfp, const std::string& filename) VL_MT_UNSAFE {
+        m_traces.emplace_back(tfp, filename);
+    }
+    /// Zero coverage in each child, and have it write to
+    /// childFilename(coverageFilename()).  A template so that coverage only
+    /// needs to be included and linked when used.
+    template <typename T_CovContext>
+    void addCoverage(T_CovContext* covp) VL_MT_UNSAFE {
+        m_coverageZero = [covp]() { covp->zero(); };
+    }
+    /// Set maximum number of children running at once, 0 = unlimited
+    void maxChildren(unsigned flag) VL_MT_UNSAFE { m_maxChildren = flag; }
+    /// Fork a child, first waiting for the oldest child to finish if
+    /// maxChildren are running.  Returns true in the child, and false in the
+    /// parent.
+    bool fork(unsigned child) VL_MT_UNSAFE;
+    /// Wait for all children to finish, return number of children that
+    /// failed (exited non-zero or were killed) since the last wait()
+    unsigned wait() VL_MT_UNSAFE;
+    /// Return filename with "_<child>" inserted before any extension
+    static std::string childFilename(const std::string& filename, unsigned child) VL_PURE;
+};
+
+#endif  // Guard
@@ -214,9 +214,9 @@ public:
     /// Return if file is open
     bool isOpen() const override VL_MT_SAFE { return m_sptrace.isOpen(); }
     /// Open a new FST file
-    virtual void open(const char* filename) VL_MT_SAFE { m_sptrace.open(filename); }
+    void open(const char* filename) override VL_MT_SAFE { m_sptrace.open(filename); }
     /// Close dump
-    void close() VL_MT_SAFE {
+    void close() override VL_MT_SAFE {
         m_sptrace.close();
         modelConnected(false);
     }
@@ -207,6 +207,15 @@ protected:
     // Used by scopeInsert, scopeFind, scopeErase, scopeNameMap
     mutable VerilatedMutex m_nameMutex;  // Protect m_nameMap
     VerilatedScopeNameMap m_nameMap VL_GUARDED_BY(m_nameMutex);
+    // Changed when a scope is erased, so caches of names can be invalidated. Unique
+    // over all contexts, so a cache can't mistake a new context for a deleted one.
+    // Atomic so it may be read without m_nameMutex.
+    std::atomic<uint64_t> m_nameGeneration{newNameGeneration()};
+
+    static uint64_t newNameGeneration() VL_MT_SAFE {
+        static std::atomic<uint64_t> s_generation{0};
+        return ++s_generation;
+    }
 };
 
 //======================================================================
@@ -269,6 +278,10 @@ public:  // But only for verilated*.cpp
     // METHODS - scope name - INTERNAL only for verilated*.cpp
     void scopeInsert(const VerilatedScope* scopep) VL_MT_SAFE;
     void scopeErase(const VerilatedScope* scopep) VL_MT_SAFE;
+    // Changes when any scope of this context was erased, e.g. a model was deleted
+    uint64_t scopeGeneration() const VL_MT_SAFE {
+        return m_impdatap->m_nameGeneration.load(std::memory_order_acquire);
+    }
 
     // METHODS - file IO - INTERNAL only for verilated*.cpp
 
@@ -144,12 +144,20 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
             Verilated::threadContextp()->profExecStart());
     fprintf(fp, "VLPROF arg +verilator+prof+exec+window+%u\n",
             Verilated::threadContextp()->profExecWindow());
+    fprintf(fp, "VLPROF arg +verilator+threads+spin+budget+%u\n",
+            Verilated::threadContextp()->threadsSpinBudget());
     std::string numa = "no threads";
+    uint64_t steals = 0;
+    uint64_t parks = VlMTaskVertex::parks();
     if (VlThreadPool* const threadPoolp
         = static_cast<VlThreadPool*>(Verilated::threadContextp()->threadPoolp())) {
         numa = threadPoolp->numaStatus();
+        steals = threadPoolp->steals();
+        parks += threadPoolp->stealParks();
     }
     fprintf(fp, "VLPROF info numa %s\n", numa.c_str());
+    const std::string cpus = Verilated::threadContextp()->threadsCpus();
+    if (!cpus.empty()) fprintf(fp, "VLPROF info cpus %s\n", cpus.c_str());
     // Note that VerilatedContext will by default create as many threads as there are hardware
     // processors, but not all of them might be utilized. Report the actual number that has trace
     // entries to avoid over-counting.
@@ -159,6 +167,8 @@ void VlExecutionProfiler::dump(const char* filenamep, uint64_t tickEnd)
     }
     fprintf(fp, "VLPROF stat threads %u\n", threads);
     fprintf(fp, "VLPROF stat yields %" PRIu64 "\n", VlMTaskVertex::yields());
+    fprintf(fp, "VLPROF stat parks %" PRIu64 "\n", parks);
+    if (steals) fprintf(fp, "VLPROF stat steals %" PRIu64 "\n", steals);
 
     // Copy /proc/cpuinfo into this output so verilator_gantt can be run on
     // a different machine
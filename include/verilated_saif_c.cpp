@@ -64,22 +64,28 @@
 
 class VerilatedSaifActivityBit final {
     // MEMBERS
-    bool m_lastVal = false;  // Last emitted activity bit value
-    uint64_t m_highTime = 0;  // Total time when bit was high
-    size_t m_transitions = 0;  // Total number of bit transitions
+    // Total time when bit was high. While the bit is high this is kept less
+    // the time it went high, so only transitions need to update it.
+    uint64_t m_highTime = 0;
+    uint64_t m_transitions = 0;  // Total number of bit transitions
 
 public:
     // METHODS
     VL_ATTR_ALWINLINE
-    void aggregateVal(uint64_t dt, bool newVal) {
-        m_transitions += newVal != m_lastVal ? 1 : 0;
-        m_highTime += m_lastVal ? dt : 0;
-        m_lastVal = newVal;
+    void toggle(uint64_t time, bool newVal) {
+        ++m_transitions;
+        if (newVal) {
+            m_highTime -= time;
+        } else {
+            m_highTime += time;
+        }
     }
 
     // ACCESSORS
-    VL_ATTR_ALWINLINE bool bitValue() const { return m_lastVal; }
-    VL_ATTR_ALWINLINE uint64_t highTime() const { return m_highTime; }
+    // Total time when bit was high, given the time now and the current bit value
+    VL_ATTR_ALWINLINE uint64_t highTime(uint64_t time, bool val) const {
+        return m_highTime + (val ? time : 0);
+    }
     VL_ATTR_ALWINLINE uint64_t toggleCount() const { return m_transitions; }
 };
 
@@ -88,14 +94,42 @@ public:
 
 class VerilatedSaifActivityVar final {
     // MEMBERS
-    uint64_t m_lastTime = 0;  // Last time when variable value was updated
+    uint64_t* m_valuep;  // Last emitted value, packed 64 bits per word
     VerilatedSaifActivityBit* m_bits;  // Pointer to variable bits objects
     uint32_t m_width;  // Width of variable (in bits)
 
+    // Index of the lowest set bit in a non-zero word
+    static VL_ATTR_ALWINLINE int lowestBit(uint64_t word) {
+#if defined(__GNUC__) && (__GNUC__ >= 4) && !defined(VL_NO_BUILTINS)
+        return __builtin_ctzll(word);
+#else
+        int bit = 0;
+        while (!(word & 1)) {
+            word >>= 1;
+            ++bit;
+        }
+        return bit;
+#endif
+    }
+
+    // Update one packed word of the value, visiting only the bits that changed
+    VL_ATTR_ALWINLINE void emitWord(uint64_t time, size_t wordIndex, uint64_t newWord) {
+        uint64_t changed = m_valuep[wordIndex] ^ newWord;
+        if (VL_LIKELY(!changed)) return;
+        m_valuep[wordIndex] = newWord;
+        VerilatedSaifActivityBit* const bitsp = m_bits + wordIndex * 64;
+        do {
+            const int bit = lowestBit(changed);
+            bitsp[bit].toggle(time, (newWord >> bit) & 1);
+            changed &= changed - 1;
+        } while (changed);
+    }
+
 public:
     // CONSTRUCTORS
-    VerilatedSaifActivityVar(uint32_t width, VerilatedSaifActivityBit* bits)
-        : m_bits{bits}
+    VerilatedSaifActivityVar(uint32_t width, uint64_t* valuep, VerilatedSaifActivityBit* bits)
+        : m_valuep{valuep}
+        , m_bits{bits}
         , m_width{width} {}
 
     VerilatedSaifActivityVar(VerilatedSaifActivityVar&&) = default;
@@ -109,20 +143,19 @@ public:
         static_assert(std::is_integral<DataType>::value,
                       "The emitted value must be of integral type");
 
-        const uint64_t dt = time - m_lastTime;
-        for (size_t i = 0; i < std::min(m_width, bits); ++i) {
-            m_bits[i].aggregateVal(dt, (newval >> i) & 1);
-        }
-        updateLastTime(time);
+        const uint32_t width = std::min(m_width, bits);
+        const uint64_t mask = width >= 64 ? ~0ULL : (1ULL << width) - 1;
+        emitWord(time, 0, static_cast<uint64_t>(newval) & mask);
     }
 
     VL_ATTR_ALWINLINE void emitWData(uint64_t time, const WData* newvalp, uint32_t bits);
-    VL_ATTR_ALWINLINE void updateLastTime(uint64_t val) { m_lastTime = val; }
 
     // ACCESSORS
     VL_ATTR_ALWINLINE uint32_t width() const { return m_width; }
-    VL_ATTR_ALWINLINE VerilatedSaifActivityBit& bit(std::size_t index);
-    VL_ATTR_ALWINLINE uint64_t lastUpdateTime() const { return m_lastTime; }
+    VL_ATTR_ALWINLINE const VerilatedSaifActivityBit& bit(std::size_t index) const;
+    VL_ATTR_ALWINLINE bool bitValue(std::size_t index) const {
+        return (m_valuep[index / 64] >> (index % 64)) & 1;
+    }
 
 private:
     // CONSTRUCTORS
@@ -199,6 +232,11 @@ class VerilatedSaifActivityAccumulator final {
     std::unordered_map<uint32_t, VerilatedSaifActivityVar> m_activity;
     // Memory pool for signals bits objects
     std::vector<std::vector<VerilatedSaifActivityBit>> m_activityArena;
+    // Memory pool for signals packed values
+    std::vector<std::vector<uint64_t>> m_valueArena;
+
+    template <typename T>
+    static T* allocate(std::vector<std::vector<T>>& arena, size_t size);
 
 public:
     // METHODS
@@ -222,25 +260,25 @@ private:
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifActivityVar::emitBit(const uint64_t time, const CData newval) {
-    assert(m_lastTime <= time);
-    m_bits[0].aggregateVal(time - m_lastTime, newval);
-    updateLastTime(time);
+    emitWord(time, 0, newval & 1);
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifActivityVar::emitWData(const uint64_t time, const WData* newvalp,
                                          const uint32_t bits) {
-    assert(m_lastTime <= time);
-    const uint64_t dt = time - m_lastTime;
-    for (std::size_t i = 0; i < std::min(m_width, bits); ++i) {
-        const size_t wordIndex = i / VL_EDATASIZE;
-        m_bits[i].aggregateVal(dt, (newvalp[wordIndex] >> VL_BITBIT_E(i)) & 1);
+    static_assert(VL_EDATASIZE == 32, "Packing assumes 32 bit words");
+    const uint32_t width = std::min(m_width, bits);
+    const size_t ewords = VL_WORDS_I(width);
+    for (size_t i = 0; i < ewords; i += 2) {
+        uint64_t word = newvalp[i];
+        if (i + 1 < ewords) word |= static_cast<uint64_t>(newvalp[i + 1]) << 32;
+        const uint32_t wordBits = std::min<uint32_t>(64, width - i * VL_EDATASIZE);
+        if (wordBits < 64) word &= (1ULL << wordBits) - 1;
+        emitWord(time, i / 2, word);
     }
-
-    updateLastTime(time);
 }
 
-VerilatedSaifActivityBit& VerilatedSaifActivityVar::bit(const std::size_t index) {
+const VerilatedSaifActivityBit& VerilatedSaifActivityVar::bit(const std::size_t index) const {
     assert(index < m_width);
     return m_bits[index];
 }
@@ -250,17 +288,25 @@ VerilatedSaifActivityBit& VerilatedSaifActivityVar::bit(const std::size_t index)
 //=============================================================================
 // VerilatedSaifActivityAccumulator implementation
 
+template <typename T>
+T* VerilatedSaifActivityAccumulator::allocate(std::vector<std::vector<T>>& arena, size_t size) {
+    const size_t block_size = 1024;
+    if (arena.empty() || arena.back().size() + size > arena.back().capacity()) {
+        arena.emplace_back();
+        arena.back().reserve(std::max(block_size, size));
+    }
+    const size_t index = arena.back().size();
+    arena.back().resize(index + size);
+    return arena.back().data() + index;
+}
+
 void VerilatedSaifActivityAccumulator::declare(uint32_t code, const std::string& absoluteScopePath,
                                                std::string variableName, int bits, bool array,
                                                int arraynum) {
-    const size_t block_size = 1024;
-    if (m_activityArena.empty()
-        || m_activityArena.back().size() + bits > m_activityArena.back().capacity()) {
-        m_activityArena.emplace_back();
-        m_activityArena.back().reserve(block_size);
-    }
-    const size_t bitsIdx = m_activityArena.back().size();
-    m_activityArena.back().resize(m_activityArena.back().size() + bits);
+    // Values are emitted masked to the width, so no bit past it ever changes
+    const size_t words = (bits + 63) / 64;
+    VerilatedSaifActivityBit* const bitsp = allocate(m_activityArena, bits);
+    uint64_t* const valuep = allocate(m_valueArena, words);
 
     if (array) {
         variableName += '[';
@@ -268,8 +314,7 @@ void VerilatedSaifActivityAccumulator::declare(uint32_t code, const std::string&
         variableName += ']';
     }
     m_scopeToActivities[absoluteScopePath].emplace_back(code, variableName);
-    m_activity.emplace(code, VerilatedSaifActivityVar{static_cast<uint32_t>(bits),
-                                                      m_activityArena.back().data() + bitsIdx});
+    m_activity.emplace(code, VerilatedSaifActivityVar{static_cast<uint32_t>(bits), valuep, bitsp});
 }
 
 //=============================================================================
@@ -399,9 +444,8 @@ void VerilatedSaif::closeNetScope() {
 bool VerilatedSaif::printActivityStats(VerilatedSaifActivityVar& activity,
                                        const std::string& activityName, bool anyNetWritten) {
     for (size_t i = 0; i < activity.width(); ++i) {
-        VerilatedSaifActivityBit& bit = activity.bit(i);
-
-        bit.aggregateVal(currentTime() - activity.lastUpdateTime(), bit.bitValue());
+        const VerilatedSaifActivityBit& bit = activity.bit(i);
+        const uint64_t highTime = bit.highTime(currentTime(), activity.bitValue(i));
 
         if (!anyNetWritten) {
             openNetScope();
@@ -419,16 +463,14 @@ bool VerilatedSaif::printActivityStats(VerilatedSaifActivityVar& activity,
 
         // We only have two-value logic so TZ, TX and TB will always be 0
         printStr(" (T0 ");
-        printStr(std::to_string(currentTime() - bit.highTime()));
+        printStr(std::to_string(currentTime() - highTime));
         printStr(") (T1 ");
-        printStr(std::to_string(bit.highTime()));
+        printStr(std::to_string(highTime));
         printStr(") (TZ 0) (TX 0) (TB 0) (TC ");
         printStr(std::to_string(bit.toggleCount()));
         printStr("))\n");
     }
 
-    activity.updateLastTime(currentTime());
-
     return anyNetWritten;
 }
 
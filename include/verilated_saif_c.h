@@ -243,12 +243,12 @@ public:
     // Open a new SAIF file
     // This includes a complete header dump each time it is called,
     // just as if this object was deleted and reconstructed.
-    virtual void open(const char* filename) VL_MT_SAFE { m_sptrace.open(filename); }
+    void open(const char* filename) override VL_MT_SAFE { m_sptrace.open(filename); }
 
     void rolloverSize(size_t size) VL_MT_SAFE {}  // NOP
 
     // Close dump
-    void close() VL_MT_SAFE {
+    void close() override VL_MT_SAFE {
         m_sptrace.close();
         modelConnected(false);
     }
@@ -30,6 +30,7 @@
 #include "verilated.h"
 #include "verilated_imp.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <fcntl.h>
 
@@ -56,6 +57,47 @@
 static const char* const VLTSAVE_HEADER_STR = "verilatorsave02\n";
 // Value of last bytes of each file (must be multiple of 8 bytes)
 static const char* const VLTSAVE_TRAILER_STR = "vltsaved";
+// Value of first bytes of each delta checkpoint file (must be 16 bytes)
+static const char* const VLTSAVE_DELTA_STR = "verilatordelta01";
+// Block index marking the end of the blocks in a delta checkpoint file
+static constexpr uint64_t VLTSAVE_DELTA_END = ~0ULL;
+
+// Delta checkpoint file format, all numbers are native-endian uint64_t:
+//   VLTSAVE_DELTA_STR, block size, sequence number in chain (0 = full)
+//   For each block present: block index, block size, block data
+//   VLTSAVE_DELTA_END, total bytes in the serialized stream
+
+static uint64_t vl_save_hash(const uint8_t* datap, size_t size) {
+    // Each step is a bijection of the hash, so a single changed word always
+    // changes the result
+    uint64_t hash = 0x9e3779b97f4a7c15ULL ^ size;
+    uint64_t word;
+    for (; size >= sizeof(word); datap += sizeof(word), size -= sizeof(word)) {
+        std::memcpy(&word, datap, sizeof(word));
+        hash = (hash ^ word) * 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 32;
+    }
+    word = 0;
+    std::memcpy(&word, datap, size);
+    hash = (hash ^ word) * 0xc4ceb9fe1a85ec53ULL;
+    return hash ^ (hash >> 29);
+}
+
+static bool vl_save_read(int fd, void* datap, size_t size) {
+    // Read exactly size bytes, return false on error or end of file
+    uint8_t* dp = static_cast<uint8_t*>(datap);
+    while (size) {
+        errno = 0;
+        const ssize_t got = ::read(fd, dp, size);
+        if (got > 0) {
+            dp += got;
+            size -= got;
+        } else if (got == 0 || (errno != EAGAIN && errno != EINTR)) {
+            return false;
+        }
+    }
+    return true;
+}
 
 //=============================================================================
 //=============================================================================
@@ -84,6 +126,40 @@ VerilatedDeserialize& VerilatedDeserialize::readAssert(const void* __restrict da
     return *this;  // For function chaining
 }
 
+VerilatedSerialize& VerilatedSerialize::writeLarge(const uint8_t* __restrict dp,
+                                                   size_t size) VL_MT_UNSAFE_ONE {
+    if (writeDirect(dp, size)) return *this;
+    while (size) {
+        bufferCheck();
+        const size_t blk = std::min(size, bufferInsertSize());
+        std::memcpy(m_cp, dp, blk);
+        m_cp += blk;
+        dp += blk;
+        size -= blk;
+    }
+    return *this;  // For function chaining
+}
+
+VerilatedDeserialize& VerilatedDeserialize::readLarge(uint8_t* __restrict dp,
+                                                      size_t size) VL_MT_UNSAFE_ONE {
+    // First use what is already in the buffer, then the rest may bypass it
+    const size_t buffered = std::min(size, static_cast<size_t>(m_endp - m_cp));
+    std::memcpy(dp, m_cp, buffered);
+    m_cp += buffered;
+    dp += buffered;
+    size -= buffered;
+    if (size && m_cp == m_endp && readDirect(dp, size)) return *this;
+    while (size) {
+        bufferCheck();
+        const size_t blk = std::min(size, bufferInsertSize());
+        std::memcpy(dp, m_cp, blk);
+        m_cp += blk;
+        dp += blk;
+        size -= blk;
+    }
+    return *this;  // For function chaining
+}
+
 void VerilatedSerialize::header() VL_MT_UNSAFE_ONE {
     VerilatedSerialize& os = *this;  // So can cut and paste standard << code below
     assert((std::strlen(VLTSAVE_HEADER_STR) & 7) == 0);  // Keep aligned
@@ -147,6 +223,20 @@ void VerilatedSave::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     header();
 }
 
+void VerilatedSave::openDelta(const char* filenamep, VerilatedSaveDelta& delta) VL_MT_UNSAFE_ONE {
+    open(filenamep);
+    if (!isOpen()) return;
+    m_deltap = &delta;
+    m_block.clear();
+    m_block.reserve(delta.m_blockSize);
+    m_blockIndex = 0;
+    m_streamSize = 0;
+    // The serialized stream is still in the buffer, so file header goes first
+    const uint64_t header[2] = {delta.m_blockSize, delta.m_sequence};
+    writeImp(VLTSAVE_DELTA_STR, std::strlen(VLTSAVE_DELTA_STR));
+    writeImp(header, sizeof(header));
+}
+
 void VerilatedRestore::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (isOpen()) return;
@@ -170,10 +260,82 @@ void VerilatedRestore::open(const char* filenamep) VL_MT_UNSAFE_ONE {
     header();
 }
 
+void VerilatedRestore::openChain(const std::vector<std::string>& filenames) VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (isOpen() || filenames.empty()) return;
+    VL_DEBUG_IF(VL_DBG_MSGF("- restore: opening restore chain ending %s\n",
+                            filenames.back().c_str()););
+
+    m_chainBlocks.clear();
+    for (size_t file = 0; file < filenames.size(); ++file) {
+        const std::string& fn = filenames[file];
+        // cppcheck-suppress duplicateExpression
+        const int fd = ::open(fn.c_str(), O_RDONLY | O_LARGEFILE | O_CLOEXEC);
+        if (VL_UNLIKELY(fd < 0)) {
+            // User code can check isOpen()
+            closeFds();
+            return;
+        }
+        m_chainFds.push_back(fd);
+        char magic[16];
+        uint64_t header[2];  // Block size, sequence number
+        if (VL_UNLIKELY(!vl_save_read(fd, magic, sizeof(magic))
+                        || std::memcmp(magic, VLTSAVE_DELTA_STR, sizeof(magic)) != 0
+                        || !vl_save_read(fd, header, sizeof(header)) || header[1] != file
+                        || (file && header[0] != m_chainBlockSize))) {
+            const std::string msg
+                = "Can't deserialize; file is not the next delta checkpoint in the chain: "s
+                  + fn;
+            VL_FATAL_MT(fn.c_str(), 0, "", msg.c_str());
+            closeFds();
+            return;
+        }
+        m_chainBlockSize = header[0];
+        // Find the blocks in this file, later files replace blocks of earlier ones
+        uint64_t offset = sizeof(magic) + sizeof(header);
+        while (true) {
+            uint64_t record[2];  // Block index, block size
+            if (VL_UNLIKELY(!vl_save_read(fd, record, sizeof(record)))) {
+                const std::string msg
+                    = "Can't deserialize; delta checkpoint file is truncated: "s + fn;
+                VL_FATAL_MT(fn.c_str(), 0, "", msg.c_str());
+                closeFds();
+                return;
+            }
+            offset += sizeof(record);
+            if (record[0] == VLTSAVE_DELTA_END) {
+                m_chainSize = record[1];
+                break;
+            }
+            if (record[0] >= m_chainBlocks.size()) m_chainBlocks.resize(record[0] + 1);
+            ChainBlock& block = m_chainBlocks[record[0]];
+            block.m_file = file;
+            block.m_offset = offset;
+            block.m_size = record[1];
+            offset += record[1];
+            ::lseek(fd, offset, SEEK_SET);
+        }
+    }
+    m_isOpen = true;
+    m_filename = filenames.back();
+    m_cp = m_bufp;
+    m_endp = m_bufp;
+    m_chainPos = 0;
+    header();
+}
+
 void VerilatedSave::closeImp() VL_MT_UNSAFE_ONE {
     if (!isOpen()) return;
     trailer();
     flushImp();
+    if (m_deltap) {
+        if (!m_block.empty()) blockDone();
+        m_deltap->m_hashes.resize(m_blockIndex);
+        ++m_deltap->m_sequence;
+        m_deltap = nullptr;
+        const uint64_t record[2] = {VLTSAVE_DELTA_END, m_streamSize};
+        writeImp(record, sizeof(record));
+    }
     m_isOpen = false;
     ::close(m_fd);  // May get error, just ignore it
 }
@@ -183,7 +345,15 @@ void VerilatedRestore::closeImp() VL_MT_UNSAFE_ONE {
     trailer();
     flushImp();
     m_isOpen = false;
-    ::close(m_fd);  // May get error, just ignore it
+    closeFds();
+}
+
+void VerilatedRestore::closeFds() VL_MT_UNSAFE_ONE {
+    if (m_fd >= 0) ::close(m_fd);  // May get error, just ignore it
+    m_fd = -1;
+    for (const int fd : m_chainFds) ::close(fd);
+    m_chainFds.clear();
+    m_chainBlocks.clear();
 }
 
 //=============================================================================
@@ -192,9 +362,51 @@ void VerilatedRestore::closeImp() VL_MT_UNSAFE_ONE {
 void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (VL_UNLIKELY(!isOpen())) return;
-    const uint8_t* wp = m_bufp;
+    if (m_deltap) {
+        // Divide into blocks, blockDone writes them if changed
+        const size_t blockSize = m_deltap->m_blockSize;
+        for (const uint8_t* dp = m_bufp; dp < m_cp;) {
+            const size_t blk = std::min<size_t>(blockSize - m_block.size(), m_cp - dp);
+            m_block.insert(m_block.end(), dp, dp + blk);
+            dp += blk;
+            if (m_block.size() == blockSize) blockDone();
+        }
+        m_streamSize += m_cp - m_bufp;
+    } else {
+        writeImp(m_bufp, m_cp - m_bufp);
+    }
+    m_cp = m_bufp;  // Reset buffer
+}
+
+bool VerilatedSave::writeDirect(const uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE {
+    // Delta checkpoints need all data to pass through the blocks
+    if (m_deltap || VL_UNLIKELY(!isOpen())) return false;
+    flushImp();
+    writeImp(datap, size);
+    return true;
+}
+
+void VerilatedSave::blockDone() VL_MT_UNSAFE_ONE {
+    std::vector<uint64_t>& hashes = m_deltap->m_hashes;
+    const uint64_t hash = vl_save_hash(m_block.data(), m_block.size());
+    const bool changed = m_deltap->m_sequence == 0 || m_blockIndex >= hashes.size()
+                         || hashes[m_blockIndex] != hash;
+    if (changed) {
+        const uint64_t record[2] = {m_blockIndex, m_block.size()};
+        writeImp(record, sizeof(record));
+        writeImp(m_block.data(), m_block.size());
+        if (m_blockIndex >= hashes.size()) hashes.resize(m_blockIndex + 1);
+        hashes[m_blockIndex] = hash;
+    }
+    ++m_blockIndex;
+    m_block.clear();
+}
+
+void VerilatedSave::writeImp(const void* datap, size_t size) VL_MT_UNSAFE_ONE {
+    const uint8_t* wp = static_cast<const uint8_t*>(datap);
+    const uint8_t* const endp = wp + size;
     while (true) {
-        const ssize_t remaining = (m_cp - wp);
+        const ssize_t remaining = (endp - wp);
         if (remaining == 0) break;
         errno = 0;
         const ssize_t got = ::write(m_fd, wp, remaining);
@@ -212,7 +424,6 @@ void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
             }
         }
     }
-    m_cp = m_bufp;  // Reset buffer
 }
 
 void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
@@ -223,6 +434,10 @@ void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     for (uint8_t* sp = m_cp; sp < m_endp; *rp++ = *sp++) {}  // Overlaps
     m_endp = m_bufp + (m_endp - m_cp);
     m_cp = m_bufp;  // Reset buffer
+    if (!m_chainFds.empty()) {
+        fillChain();
+        return;
+    }
     // Read into buffer starting at m_endp
     while (true) {
         const ssize_t remaining = (m_bufp + bufferSize() - m_endp);
@@ -250,6 +465,70 @@ void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     }
 }
 
+bool VerilatedRestore::readDirect(uint8_t* datap, size_t size) VL_MT_UNSAFE_ONE {
+    if (!m_chainFds.empty() || VL_UNLIKELY(!isOpen())) return false;
+    while (size) {
+        errno = 0;
+        const ssize_t got = ::read(m_fd, datap, size);
+        if (got > 0) {
+            datap += got;
+            size -= got;
+        } else if (VL_UNCOVERABLE(got < 0)) {
+            if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
+                // LCOV_EXCL_START
+                const std::string msg = std::string{__FUNCTION__} + ": " + std::strerror(errno);
+                VL_FATAL_MT("", 0, "", msg.c_str());
+                close();
+                return true;
+                // LCOV_EXCL_STOP
+            }
+        } else {  // got==0, EOF
+            // Same as fill() does, past the end of file is NULLs
+            std::memset(datap, 0, size);
+            break;
+        }
+    }
+    return true;
+}
+
+void VerilatedRestore::fillChain() VL_MT_UNSAFE_ONE {
+    // Read into buffer starting at m_endp, from the latest copy of each block
+    uint8_t* const bufEndp = m_bufp + bufferSize();
+    while (m_endp < bufEndp && m_chainPos < m_chainSize) {
+        const uint64_t index = m_chainPos / m_chainBlockSize;
+        const uint64_t within = m_chainPos % m_chainBlockSize;
+        const ChainBlock block = index < m_chainBlocks.size() ? m_chainBlocks[index] : ChainBlock{};
+        if (VL_UNLIKELY(within >= block.m_size)) {
+            const std::string fn = filename();
+            const std::string msg
+                = "Can't deserialize; delta checkpoint chain is missing data: "s + fn;
+            VL_FATAL_MT(fn.c_str(), 0, "", msg.c_str());
+            close();
+            return;
+        }
+        const size_t size = std::min<uint64_t>(
+            {block.m_size - within, static_cast<uint64_t>(bufEndp - m_endp),
+             m_chainSize - m_chainPos});
+        const int fd = m_chainFds[block.m_file];
+        if (VL_UNLIKELY(::lseek(fd, block.m_offset + within, SEEK_SET) < 0
+                        || !vl_save_read(fd, m_endp, size))) {
+            // LCOV_EXCL_START
+            const std::string msg = std::string{__FUNCTION__} + ": " + std::strerror(errno);
+            VL_FATAL_MT("", 0, "", msg.c_str());
+            close();
+            return;
+            // LCOV_EXCL_STOP
+        }
+        m_endp += size;
+        m_chainPos += size;
+    }
+    // At end, fill buffer from here to end with NULLs so reader's don't
+    // need to check eof each character.
+    if (m_chainPos >= m_chainSize) {
+        while (m_endp < bufEndp) *m_endp++ = '\0';
+    }
+}
+
 //=============================================================================
 // Serialization of types
 
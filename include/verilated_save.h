@@ -27,6 +27,7 @@
 #include "verilated.h"
 
 #include <string>
+#include <vector>
 
 //=============================================================================
 // VerilatedSerialize
@@ -52,6 +53,11 @@ protected:
 
     void header() VL_MT_UNSAFE_ONE;
     void trailer() VL_MT_UNSAFE_ONE;
+    // Write large data to the stream without staging it in the buffer,
+    // return false if the stream can't, in which case the buffer is used
+    virtual bool writeDirect(const uint8_t* /*datap*/, size_t /*size*/) VL_MT_UNSAFE_ONE {
+        return false;
+    }
 
     // CONSTRUCTORS
     VL_UNCOPYABLE(VerilatedSerialize);
@@ -79,18 +85,15 @@ public:
     /// Write data to stream
     VerilatedSerialize& write(const void* __restrict datap, size_t size) VL_MT_UNSAFE_ONE {
         const uint8_t* __restrict dp = static_cast<const uint8_t* __restrict>(datap);
-        while (size) {
-            bufferCheck();
-            size_t blk = size;
-            if (blk > bufferInsertSize()) blk = bufferInsertSize();
-            const uint8_t* __restrict maxp = dp + blk;
-            for (; dp < maxp; *m_cp++ = *dp++) {}
-            size -= blk;
-        }
+        if (VL_UNLIKELY(size > bufferInsertSize())) return writeLarge(dp, size);
+        bufferCheck();
+        std::memcpy(m_cp, dp, size);
+        m_cp += size;
         return *this;  // For function chaining
     }
 
 private:
+    VerilatedSerialize& writeLarge(const uint8_t* __restrict dp, size_t size) VL_MT_UNSAFE_ONE;
     VerilatedSerialize& bufferCheck() VL_MT_UNSAFE_ONE {
         // Flush the write buffer if there's not enough space left for new information
         // We only call this once per vector, so we need enough slop for a very wide "b###" line
@@ -125,6 +128,12 @@ protected:
     virtual void fill() = 0;
     void header() VL_MT_UNSAFE_ONE;
     void trailer() VL_MT_UNSAFE_ONE;
+    // Read large data from the stream position after m_endp without staging
+    // it in the buffer, return false if the stream can't, in which case the
+    // buffer is used
+    virtual bool readDirect(uint8_t* /*datap*/, size_t /*size*/) VL_MT_UNSAFE_ONE {
+        return false;
+    }
 
     // CONSTRUCTORS
     VL_UNCOPYABLE(VerilatedDeserialize);
@@ -152,14 +161,10 @@ public:
     /// Read data from stream
     VerilatedDeserialize& read(void* __restrict datap, size_t size) VL_MT_UNSAFE_ONE {
         uint8_t* __restrict dp = static_cast<uint8_t* __restrict>(datap);
-        while (size) {
-            bufferCheck();
-            size_t blk = size;
-            if (blk > bufferInsertSize()) blk = bufferInsertSize();
-            const uint8_t* __restrict maxp = dp + blk;
-            for (; dp < maxp; *dp++ = *m_cp++) {}
-            size -= blk;
-        }
+        if (VL_UNLIKELY(size > bufferInsertSize())) return readLarge(dp, size);
+        bufferCheck();
+        std::memcpy(dp, m_cp, size);
+        m_cp += size;
         return *this;  // For function chaining
     }
 
@@ -171,6 +176,7 @@ public:
     }
 
 private:
+    VerilatedDeserialize& readLarge(uint8_t* __restrict dp, size_t size) VL_MT_UNSAFE_ONE;
     bool readDiffers(const void* __restrict datap, size_t size) VL_MT_UNSAFE_ONE;
     VerilatedDeserialize& bufferCheck() VL_MT_UNSAFE_ONE {
         // Flush the write buffer if there's not enough space left for new information
@@ -180,6 +186,37 @@ private:
     }
 };
 
+//=============================================================================
+// VerilatedSaveDelta
+/// State kept between the delta checkpoints of a model.
+///
+/// The serialized model is divided into fixed size blocks, and a hash of
+/// each block is kept.  A checkpoint written by VerilatedSave::openDelta
+/// holds only the blocks that differ from the previous checkpoint made with
+/// the same VerilatedSaveDelta, so the first checkpoint holds all blocks.
+
+class VerilatedSaveDelta final {
+    friend class VerilatedSave;
+    // MEMBERS
+    const size_t m_blockSize;  // Bytes per block
+    uint64_t m_sequence = 0;  // Number of checkpoints in the chain
+    std::vector<uint64_t> m_hashes;  // Hash of each block of the previous checkpoint
+
+public:
+    // CONSTRUCTORS
+    /// Construct, with the given number of bytes per block
+    explicit VerilatedSaveDelta(size_t blockSize = 64 * 1024)
+        : m_blockSize{blockSize} {}
+    // METHODS
+    /// Make the next checkpoint a full one, starting a new chain
+    void reset() {
+        m_sequence = 0;
+        m_hashes.clear();
+    }
+    /// Return number of checkpoints in the chain
+    uint64_t sequence() const { return m_sequence; }
+};
+
 //=============================================================================
 // VerilatedSave
 /// Stream-like object that serializes Verilated model to a file.
@@ -189,9 +226,16 @@ private:
 class VerilatedSave final : public VerilatedSerialize {
 private:
     int m_fd = -1;  // File descriptor we're writing to
+    VerilatedSaveDelta* m_deltap = nullptr;  // Delta state, when writing a delta checkpoint
+    std::vector<uint8_t> m_block;  // Data of current block, when m_deltap
+    uint64_t m_blockIndex = 0;  // Index of current block, when m_deltap
+    uint64_t m_streamSize = 0;  // Bytes serialized, when m_deltap
 
     void closeImp() VL_MT_UNSAFE_ONE;
     void flushImp() VL_MT_UNSAFE_ONE;
+    void writeImp(const void* datap, size_t size) VL_MT_UNSAFE_ONE;
+    void blockDone() VL_MT_UNSAFE_ONE;
+    bool writeDirect(const uint8_t* datap, size_t size) override VL_MT_UNSAFE_ONE;
 
 public:
     // CONSTRUCTORS
@@ -204,6 +248,10 @@ public:
     void open(const char* filenamep) VL_MT_UNSAFE_ONE;
     /// Open the file; call isOpen() to see if errors
     void open(const std::string& filename) VL_MT_UNSAFE_ONE { open(filename.c_str()); }
+    /// Open the file as a delta checkpoint, holding only the parts of the
+    /// model that changed since the previous checkpoint made with 'delta'.
+    /// Restore with VerilatedRestore::openChain.  Call isOpen() to see if errors.
+    void openDelta(const char* filenamep, VerilatedSaveDelta& delta) VL_MT_UNSAFE_ONE;
     /// Flush and close the file
     void close() override VL_MT_UNSAFE_ONE { closeImp(); }
     /// Flush data to file
@@ -218,10 +266,26 @@ public:
 
 class VerilatedRestore final : public VerilatedDeserialize {
 private:
+    // TYPES
+    struct ChainBlock final {  // Where the latest copy of a block is in a delta chain
+        size_t m_file = 0;  // Index into m_chainFds
+        uint64_t m_offset = 0;  // Offset of block data in file
+        uint64_t m_size = 0;  // Bytes in block, 0 = not present
+    };
+
+    // MEMBERS
     int m_fd = -1;  // File descriptor we're writing to
+    std::vector<int> m_chainFds;  // File descriptors of delta chain, base first
+    std::vector<ChainBlock> m_chainBlocks;  // Latest copy of each block of delta chain
+    uint64_t m_chainBlockSize = 0;  // Bytes per block of delta chain
+    uint64_t m_chainSize = 0;  // Bytes in stream of delta chain
+    uint64_t m_chainPos = 0;  // Bytes of delta chain stream read so far
 
     void closeImp() VL_MT_UNSAFE_ONE;
     void flushImp() VL_MT_UNSAFE_ONE {}
+    void closeFds() VL_MT_UNSAFE_ONE;
+    void fillChain() VL_MT_UNSAFE_ONE;
+    bool readDirect(uint8_t* datap, size_t size) override VL_MT_UNSAFE_ONE;
 
 public:
     // CONSTRUCTORS
@@ -235,6 +299,10 @@ public:
     void open(const char* filenamep) VL_MT_UNSAFE_ONE;
     /// Open the file; call isOpen() to see if errors
     void open(const std::string& filename) VL_MT_UNSAFE_ONE { open(filename.c_str()); }
+    /// Open a chain of checkpoints made with VerilatedSave::openDelta, the
+    /// first (full) checkpoint first, and restore the state as of the last.
+    /// Call isOpen() to see if errors.
+    void openChain(const std::vector<std::string>& filenames) VL_MT_UNSAFE_ONE;
     /// Close the file
     void close() override VL_MT_UNSAFE_ONE { closeImp(); }
     void flush() override VL_MT_UNSAFE_ONE { flushImp(); }
@@ -25,9 +25,11 @@
 
 #include "verilated_threads.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -35,12 +37,44 @@
 #include <pthread_np.h>
 #endif
 
+#ifdef __linux
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 //=============================================================================
 // Globals
 
 // Internal note: Globals may multi-construct, see verilated.cpp top.
 
 std::atomic<uint64_t> VlMTaskVertex::s_yields;
+std::atomic<uint64_t> VlMTaskVertex::s_parks;
+thread_local VlWorkStealDeque* VlThreadPool::t_stealDequep = nullptr;
+thread_local VlThreadPool* VlThreadPool::t_stealPoolp = nullptr;
+thread_local unsigned VlWorkerThread::t_threadNumber = 0;
+thread_local const VlThreadPool* VlWorkerThread::t_poolp = nullptr;
+
+//=============================================================================
+// Futex helpers
+
+// Sleep until woken, but only if 'word' still holds 'value'
+static void vlFutexWait(const std::atomic<uint32_t>& word, uint32_t value) {
+#ifdef __linux
+    syscall(SYS_futex, reinterpret_cast<const uint32_t*>(&word), FUTEX_WAIT_PRIVATE, value,
+            nullptr, nullptr, 0);
+#else
+    VlMTaskVertex::yieldThread();
+#endif
+}
+
+// Wake all threads sleeping on 'word'
+static void vlFutexWakeAll(const std::atomic<uint32_t>& word) {
+#ifdef __linux
+    syscall(SYS_futex, reinterpret_cast<const uint32_t*>(&word), FUTEX_WAKE_PRIVATE,
+            std::numeric_limits<int>::max(), nullptr, nullptr, 0);
+#endif
+}
 
 //=============================================================================
 // VlMTaskVertex
@@ -51,12 +85,35 @@ VlMTaskVertex::VlMTaskVertex(uint32_t upstreamDepCount)
     assert(atomic_is_lock_free(&m_upstreamDepsDone));
 }
 
+void VlMTaskVertex::waitUntilUpstreamDoneSlow(bool evenCycle) const {
+    // Spin, cheapest if the upstream mtask is about to finish
+    const uint32_t spins = Verilated::threadContextp()->threadsSpinBudget();
+    for (uint32_t i = 0; i < spins; ++i) {
+        if (areUpstreamDepsDone(evenCycle)) return;
+        VL_CPU_RELAX();
+    }
+    ++s_parks;  // Statistics
+    const uint32_t target = evenCycle ? m_upstreamDepCount : 0;
+    while (true) {
+        // Register before checking, see signalUpstreamDone
+        m_parked.fetch_add(1, std::memory_order_seq_cst);
+        const uint32_t value = m_upstreamDepsDone.load(std::memory_order_seq_cst);
+        if (value != target) vlFutexWait(m_upstreamDepsDone, value);
+        m_parked.fetch_sub(1, std::memory_order_relaxed);
+        if (areUpstreamDepsDone(evenCycle)) return;
+    }
+}
+
+void VlMTaskVertex::wakeParked() const { vlFutexWakeAll(m_upstreamDepsDone); }
+
 //=============================================================================
 // VlWorkerThread
 
-VlWorkerThread::VlWorkerThread(VerilatedContext* contextp)
+VlWorkerThread::VlWorkerThread(VerilatedContext* contextp, const VlThreadPool* poolp,
+                               unsigned index)
     : m_ready_size{0}
-    , m_cthread{startWorker, this, contextp} {}
+    , m_contextp{contextp}
+    , m_cthread{startWorker, this, contextp, poolp, index} {}
 
 VlWorkerThread::~VlWorkerThread() {
     shutdown();
@@ -97,20 +154,107 @@ void VlWorkerThread::workerLoop() {
     }
 }
 
-void VlWorkerThread::startWorker(VlWorkerThread* workerp, VerilatedContext* contextp) {
+void VlWorkerThread::startWorker(VlWorkerThread* workerp, VerilatedContext* contextp,
+                                 const VlThreadPool* poolp, unsigned index) {
+    t_threadNumber = index + 1;
+    t_poolp = poolp;
     Verilated::threadContextp(contextp);
     workerp->workerLoop();
 }
 
+//=============================================================================
+// VlThreadScheduleSelector
+
+void VlThreadScheduleSelector::configure(uint32_t warmup, uint32_t nMTaskIds,
+                                         const uint32_t* predsp, uint32_t nAlternatives,
+                                         const uint32_t* alternativesp) VL_MT_UNSAFE {
+    m_costs.assign(nMTaskIds, 0);
+    m_predps.assign(nMTaskIds, nullptr);
+    for (; *predsp != nMTaskIds; predsp += predsp[1] + 2) m_predps[predsp[0]] = predsp + 1;
+    m_alternativesp = alternativesp;
+    m_nAlternatives = nAlternatives;
+    m_evenCycles.assign(nAlternatives, false);
+    m_warmup = warmup;
+    m_selected = 0;
+    m_measuring = warmup && nAlternatives > 1;
+    m_configured = true;
+}
+
+uint64_t VlThreadScheduleSelector::predict(uint32_t alternative) const VL_MT_UNSAFE {
+    // Find the alternative's encoding
+    const uint32_t* altp = m_alternativesp;
+    for (uint32_t a = 0; a < alternative; ++a) {
+        const uint32_t nThreads = *altp++;
+        for (uint32_t t = 0; t < nThreads; ++t) altp += *altp + 1;
+    }
+
+    // Replay the alternative with measured costs. Each thread runs its
+    // sequence of mtasks in order, starting each when its upstream mtasks
+    // have completed.
+    const uint32_t nThreads = *altp++;
+    std::vector<const uint32_t*> nextps(nThreads);  // Next mtask on each thread
+    std::vector<const uint32_t*> endps(nThreads);  // End of each thread's sequence
+    std::vector<uint64_t> threadTimes(nThreads, 0);  // Time each thread is busy until
+    for (uint32_t t = 0; t < nThreads; ++t) {
+        nextps[t] = altp + 1;
+        endps[t] = altp + 1 + *altp;
+        altp = endps[t];
+    }
+    constexpr uint64_t NOT_DONE = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> endTimes(m_costs.size(), NOT_DONE);
+    bool progress = true;
+    while (progress) {
+        progress = false;
+        for (uint32_t t = 0; t < nThreads; ++t) {
+            while (nextps[t] != endps[t]) {
+                const uint32_t id = *nextps[t];
+                uint64_t startTime = threadTimes[t];
+                bool ready = true;
+                if (const uint32_t* const predp = m_predps[id]) {
+                    for (uint32_t i = 1; i <= predp[0]; ++i) {
+                        const uint64_t predEndTime = endTimes[predp[i]];
+                        if (predEndTime == NOT_DONE) {
+                            ready = false;
+                            break;
+                        }
+                        startTime = std::max(startTime, predEndTime);
+                    }
+                }
+                if (!ready) break;
+                endTimes[id] = threadTimes[t] = startTime + m_costs[id];
+                ++nextps[t];
+                progress = true;
+            }
+        }
+    }
+    return *std::max_element(threadTimes.begin(), threadTimes.end());
+}
+
+void VlThreadScheduleSelector::select() VL_MT_UNSAFE {
+    m_measuring = false;
+    uint64_t bestTime = predict(0);
+    for (uint32_t a = 1; a < m_nAlternatives; ++a) {
+        const uint64_t time = predict(a);
+        if (time < bestTime) {
+            bestTime = time;
+            m_selected = a;
+        }
+    }
+    VL_DEBUG_IF(VL_DBG_MSGF("+ Thread schedule alternative %u selected, predicted %" PRIu64
+                            " ticks\n",
+                            m_selected, bestTime););
+}
+
 //=============================================================================
 // VlThreadPool
 
 VlThreadPool::VlThreadPool(VerilatedContext* contextp, unsigned nThreads) {
     for (unsigned i = 0; i < nThreads; ++i) {
-        m_workers.push_back(new VlWorkerThread{contextp});
+        m_workers.push_back(new VlWorkerThread{contextp, this, i});
         m_unassignedWorkers.push(i);
     }
-    m_numaStatus = numaAssign();
+    const std::vector<unsigned> cpus = contextp->threadsCpuList();
+    m_numaStatus = cpus.empty() ? numaAssign() : cpuListAssign(cpus);
 }
 
 VlThreadPool::~VlThreadPool() {
@@ -118,6 +262,86 @@ VlThreadPool::~VlThreadPool() {
     for (auto& i : m_workers) delete i;
 }
 
+void VlThreadPool::stealBegin(VlSelfP selfp, bool evenCycle, size_t nTasks) {
+    // Workers have all left stealLoop at the end of the previous stealRun,
+    // so the deques may be reset without synchronization.
+    if (m_stealDeques.empty()) {
+        for (size_t i = 0; i <= m_workers.size(); ++i) {
+            m_stealDeques.emplace_back(new VlWorkStealDeque);
+        }
+    }
+    for (const auto& dequep : m_stealDeques) dequep->reset(nTasks);
+    m_stealSelfp = selfp;
+    m_stealEvenCycle = evenCycle;
+}
+
+void VlThreadPool::stealRun(unsigned nWorkers, const VlMTaskVertex& doneVertex) {
+    assert(nWorkers < m_stealDeques.size());
+    m_stealDonep = &doneVertex;
+    m_stealNDeques = nWorkers + 1;
+    m_stealNextIndex.store(0, std::memory_order_relaxed);
+    m_stealersActive.store(nWorkers, std::memory_order_relaxed);
+    for (unsigned i = 0; i < nWorkers; ++i) m_workers[i]->addTask(stealLoopTask, this);
+    // The main thread owns the deque after the last worker
+    stealLoop(nWorkers);
+    // Wait for the workers to notice completion, so the next graph may reset the deques
+    while (m_stealersActive.load(std::memory_order_acquire)) VL_CPU_RELAX();
+    m_stealDonep = nullptr;
+}
+
+void VlThreadPool::stealLoopTask(VlSelfP poolp, bool) {
+    VlThreadPool* const selfp = static_cast<VlThreadPool*>(poolp);
+    selfp->stealLoop(selfp->m_stealNextIndex.fetch_add(1, std::memory_order_relaxed));
+    selfp->m_stealersActive.fetch_sub(1, std::memory_order_release);
+}
+
+void VlThreadPool::stealLoop(size_t index) {
+    const size_t nDeques = m_stealNDeques;
+    const uint32_t spins = Verilated::threadContextp()->threadsSpinBudget();
+    VlWorkStealDeque* const ownp = m_stealDeques[index].get();
+    t_stealDequep = ownp;
+    t_stealPoolp = this;
+    unsigned ct = 0;
+    while (!m_stealDonep->areUpstreamDepsDone(m_stealEvenCycle)) {
+        VlExecFnp fnp = ownp->pop();
+        // Own deque is empty, try the others, starting after ourselves
+        for (size_t i = 1; !fnp && i < nDeques; ++i) {
+            fnp = m_stealDeques[(index + i) % nDeques]->steal();
+            if (fnp) m_steals.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (fnp) {
+            fnp(m_stealSelfp, m_stealEvenCycle);
+            ct = 0;
+            // Parked threads must wake to leave, the last mtask pushes nothing
+            if (m_stealDonep->areUpstreamDepsDone(m_stealEvenCycle)) stealNotify();
+            continue;
+        }
+        VL_CPU_RELAX();
+        if (VL_UNLIKELY(++ct > spins)) {
+            ct = 0;
+            stealPark(nDeques);
+        }
+    }
+    t_stealDequep = nullptr;
+    t_stealPoolp = nullptr;
+}
+
+void VlThreadPool::stealPark(size_t nDeques) {
+    // Register before checking, see stealNotify
+    m_stealParked.fetch_add(1, std::memory_order_seq_cst);
+    const uint32_t generation = m_stealWork.load(std::memory_order_seq_cst);
+    bool idle = !m_stealDonep->areUpstreamDepsDone(m_stealEvenCycle);
+    for (size_t i = 0; idle && i < nDeques; ++i) idle = m_stealDeques[i]->empty();
+    if (idle) {
+        m_stealParks.fetch_add(1, std::memory_order_relaxed);  // Statistics
+        // Sleeps only if nothing was pushed since 'generation' was read
+        vlFutexWait(m_stealWork, generation);
+    }
+    m_stealParked.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void VlThreadPool::stealWake() { vlFutexWakeAll(m_stealWork); }
+
 bool VlThreadPool::isNumactlRunning() {
     // We assume if current thread is CPU-masked, then under numactl, otherwise not.
     // This shows that numactl is visible through the affinity mask
@@ -134,6 +358,30 @@ bool VlThreadPool::isNumactlRunning() {
     return false;
 }
 
+std::string VlThreadPool::cpuListAssign(const std::vector<unsigned>& cpus) {
+#if defined(__linux) || defined(CPU_ZERO) || defined(VL_CPPCHECK)  // Linux-like pthreads
+    // Pin the main thread to the first CPU, then workers round-robin on the rest
+    std::string status = "pinned ";
+    const auto pin = [&](pthread_t thread, unsigned cpu) {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(cpu, &cpuset);
+        status += std::to_string(cpu) + ";";
+        return pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuset) == 0;
+    };
+    if (!pin(pthread_self(), cpus[0])) return "%Warning: pthread_setaffinity_np failed";
+    for (size_t i = 0; i < m_workers.size(); ++i) {
+        const unsigned cpu = cpus[(i + 1) % cpus.size()];
+        if (!pin(m_workers[i]->m_cthread.native_handle(), cpu)) {
+            return "%Warning: pthread_setaffinity_np failed";
+        }
+    }
+    return status;
+#else
+    return "non-supported host OS";
+#endif
+}
+
 std::string VlThreadPool::numaAssign() {
 #if defined(__linux) || defined(CPU_ZERO) || defined(VL_CPPCHECK)  // Linux-like pthreads
     // If not under numactl, make a reasonable processor affinity selection
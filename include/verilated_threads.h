@@ -29,6 +29,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <set>
 #include <stack>
 #include <thread>
@@ -48,6 +49,7 @@ using VlExecFnp = void (*)(VlSelfP, bool);
 class VlMTaskVertex final {
     // MEMBERS
     static std::atomic<uint64_t> s_yields;  // Statistics
+    static std::atomic<uint64_t> s_parks;  // Statistics
 
     // On even cycles, _upstreamDepsDone increases as upstream
     // dependencies complete. When it reaches _upstreamDepCount,
@@ -67,6 +69,8 @@ class VlMTaskVertex final {
     // use 16-bit types here...)
     std::atomic<uint32_t> m_upstreamDepsDone;
     const uint32_t m_upstreamDepCount;
+    // Number of threads sleeping in waitUntilUpstreamDone, that need a wakeup
+    mutable std::atomic<uint32_t> m_parked{0};
 
 public:
     // CONSTRUCTORS
@@ -78,6 +82,7 @@ public:
     ~VlMTaskVertex() = default;
 
     static uint64_t yields() { return s_yields; }
+    static uint64_t parks() { return s_parks; }
     static void yieldThread() {
         ++s_yields;  // Statistics
         std::this_thread::yield();
@@ -87,35 +92,182 @@ public:
     // Returns true when the current MTaskVertex becomes ready to execute,
     // false while it's still waiting on more dependencies.
     bool signalUpstreamDone(bool evenCycle) {
+        // Sequentially consistent, so either a parking waiter sees the new
+        // count, or we see m_parked set below
+        bool ready;
         if (evenCycle) {
             const uint32_t upstreamDepsDone
-                = 1 + m_upstreamDepsDone.fetch_add(1, std::memory_order_release);
+                = 1 + m_upstreamDepsDone.fetch_add(1, std::memory_order_seq_cst);
             assert(upstreamDepsDone <= m_upstreamDepCount);
-            return (upstreamDepsDone == m_upstreamDepCount);
+            ready = (upstreamDepsDone == m_upstreamDepCount);
         } else {
             const uint32_t upstreamDepsDone_prev
-                = m_upstreamDepsDone.fetch_sub(1, std::memory_order_release);
+                = m_upstreamDepsDone.fetch_sub(1, std::memory_order_seq_cst);
             assert(upstreamDepsDone_prev > 0);
-            return (upstreamDepsDone_prev == 1);
+            ready = (upstreamDepsDone_prev == 1);
         }
+        if (VL_UNLIKELY(ready && m_parked.load(std::memory_order_seq_cst))) wakeParked();
+        return ready;
     }
     bool areUpstreamDepsDone(bool evenCycle) const {
         const uint32_t target = evenCycle ? m_upstreamDepCount : 0;
         return m_upstreamDepsDone.load(std::memory_order_acquire) == target;
     }
+    // Spin up to VerilatedContext::threadsSpinBudget() times, then sleep
+    // until the last upstream dependency signals
     void waitUntilUpstreamDone(bool evenCycle) const {
-        unsigned ct = 0;
-        while (VL_UNLIKELY(!areUpstreamDepsDone(evenCycle))) {
-            VL_CPU_RELAX();
-            ++ct;
-            if (VL_UNLIKELY(ct > VL_LOCK_SPINS)) {
-                ct = 0;
-                yieldThread();
+        if (VL_LIKELY(areUpstreamDepsDone(evenCycle))) return;
+        waitUntilUpstreamDoneSlow(evenCycle);
+    }
+
+private:
+    void waitUntilUpstreamDoneSlow(bool evenCycle) const;
+    void wakeParked() const;
+};
+
+// Lock-free work-stealing deque of ready mtask functions (Chase-Lev).
+// Only the owning thread may push() and pop(), any thread may steal().
+// The deque does not wrap; within one execution graph each mtask is pushed
+// at most once, so reset() to the graph size gives enough capacity.
+class VlWorkStealDeque final {
+    // MEMBERS
+    std::atomic<int64_t> m_top{0};  // Steal end, advanced by thieves
+    // Keep thieves and the owner on separate cache lines
+    uint8_t m_padding[VL_CACHE_LINE_BYTES - sizeof(std::atomic<int64_t>)];
+    std::atomic<int64_t> m_bottom{0};  // Owner end
+    std::unique_ptr<std::atomic<VlExecFnp>[]> m_bufp;  // Task storage
+    int64_t m_capacity = 0;  // Number of elements in m_bufp
+
+    VL_UNCOPYABLE(VlWorkStealDeque);
+
+public:
+    // CONSTRUCTORS
+    VlWorkStealDeque() = default;
+    ~VlWorkStealDeque() = default;
+
+    // METHODS
+    // Empty the deque, with room for 'capacity' pushes. Not thread safe.
+    void reset(size_t capacity) {
+        if (static_cast<int64_t>(capacity) > m_capacity) {
+            m_capacity = static_cast<int64_t>(capacity);
+            m_bufp.reset(new std::atomic<VlExecFnp>[capacity]);
+        }
+        m_top.store(0, std::memory_order_relaxed);
+        m_bottom.store(0, std::memory_order_relaxed);
+    }
+    // Owner only: add a task at the bottom
+    void push(VlExecFnp fnp) {
+        const int64_t b = m_bottom.load(std::memory_order_relaxed);
+        assert(b < m_capacity);
+        m_bufp[b].store(fnp, std::memory_order_relaxed);
+        m_bottom.store(b + 1, std::memory_order_release);
+    }
+    // Owner only: take the most recently pushed task, or nullptr if empty
+    VlExecFnp pop() {
+        const int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = m_top.load(std::memory_order_relaxed);
+        if (t > b) {  // Empty
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        VlExecFnp fnp = m_bufp[b].load(std::memory_order_relaxed);
+        if (t == b) {  // Last element, race against thieves
+            if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                               std::memory_order_relaxed)) {
+                fnp = nullptr;
             }
+            m_bottom.store(b + 1, std::memory_order_relaxed);
         }
+        return fnp;
+    }
+    // Any thread: true if no task may be taken
+    bool empty() const {
+        return m_top.load(std::memory_order_seq_cst) >= m_bottom.load(std::memory_order_seq_cst);
+    }
+    // Any thread: take the oldest task, or nullptr if empty or lost a race
+    VlExecFnp steal() {
+        int64_t t = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = m_bottom.load(std::memory_order_acquire);
+        if (t >= b) return nullptr;
+        VlExecFnp const fnp = m_bufp[t].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                           std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return fnp;
     }
 };
 
+// Selects among alternative static thread schedules of one mtask graph,
+// created by Verilating with --threads-alternatives. For a warm-up period
+// the generated code measures the cost of every mtask. Then the completion
+// time of each alternative is predicted from the measured costs, and the
+// fastest alternative is used from then on. Only accessed from the thread
+// calling eval, except for the counters, which are unique to each mtask.
+class VlThreadScheduleSelector final {
+    // MEMBERS
+    std::vector<uint64_t> m_costs;  // Measured cost of each mtask, indexed by mtask id
+    std::vector<const uint32_t*> m_predps;  // Count and ids of upstream mtasks, by mtask id
+    const uint32_t* m_alternativesp = nullptr;  // Encoded thread sequences of each alternative
+    uint32_t m_nAlternatives = 0;  // Number of alternatives
+    uint32_t m_warmup = 0;  // Evaluations left until selection
+    uint32_t m_selected = 0;  // Alternative to run
+    std::vector<bool> m_evenCycles;  // Even/odd cycle flag of each alternative
+    bool m_configured = false;  // configure() was called
+    bool m_measuring = false;  // Measuring mtask costs
+
+    VL_UNCOPYABLE(VlThreadScheduleSelector);
+
+public:
+    // CONSTRUCTORS
+    VlThreadScheduleSelector() = default;
+    ~VlThreadScheduleSelector() = default;
+
+    // METHODS
+    bool configured() const { return m_configured; }
+    // Set up from tables emitted by Verilator, that must outlive the selector.
+    // Selection happens after 'warmup' evaluations, or never if zero.
+    // 'predsp' has records of an mtask id, its number of upstream mtasks and their ids,
+    // terminated by 'nMTaskIds'.
+    // 'alternativesp' has for each alternative the number of threads, then for each
+    // thread the number of mtasks and their ids in execution order.
+    void configure(uint32_t warmup, uint32_t nMTaskIds, const uint32_t* predsp,
+                   uint32_t nAlternatives, const uint32_t* alternativesp) VL_MT_UNSAFE;
+    bool measuring() const { return m_measuring; }
+    uint32_t selected() const { return m_selected; }
+    // Alternate and return the even/odd cycle flag of an alternative that is about
+    // to run. Each alternative has its own VlMTaskVertex states, whose counters
+    // only alternate when that alternative runs.
+    bool toggleEvenCycle(uint32_t alternative) {
+        const bool evenCycle = !m_evenCycles[alternative];
+        m_evenCycles[alternative] = evenCycle;
+        return evenCycle;
+    }
+    // No lock around counters, as mtask ids are unique per thread
+    void startCounter(uint32_t id) {
+        uint64_t tick;
+        VL_GET_CPU_TICK(tick);
+        m_costs[id] -= tick;
+    }
+    void stopCounter(uint32_t id) {
+        uint64_t tick;
+        VL_GET_CPU_TICK(tick);
+        m_costs[id] += tick;
+    }
+    // Called after each evaluation of the graph, when all mtasks have completed
+    void graphDone() {
+        if (VL_UNLIKELY(m_measuring) && --m_warmup == 0) select();
+    }
+    // Predicted evaluation time of an alternative, with the measured costs
+    uint64_t predict(uint32_t alternative) const VL_MT_UNSAFE;
+
+private:
+    void select() VL_MT_UNSAFE;
+};
+
 class VlWorkerThread final {
 private:
     // TYPES
@@ -143,7 +295,12 @@ private:
     // Store the size atomically, so we can spin wait
     std::atomic<size_t> m_ready_size;
 
+    VerilatedContext* const m_contextp;  // Context for spin budget
     std::thread m_cthread;  // Underlying C++ thread record
+    // 1 + index in its pool of the worker running this thread, 0 if not a worker
+    static thread_local unsigned t_threadNumber;
+    // Pool of the worker running this thread, nullptr if not a worker
+    static thread_local const VlThreadPool* t_poolp;
 
     VL_UNCOPYABLE(VlWorkerThread);
 
@@ -153,15 +310,23 @@ protected:
 
 public:
     // CONSTRUCTORS
-    explicit VlWorkerThread(VerilatedContext* contextp);
+    VlWorkerThread(VerilatedContext* contextp, const VlThreadPool* poolp, unsigned index);
     ~VlWorkerThread();
 
+    // ACCESSORS
+    // 1 + index in its pool of the worker running the calling thread, or 0
+    // if not called from a worker, e.g. from the thread calling eval()
+    static unsigned threadNumber() { return t_threadNumber; }
+    // Pool of the worker running the calling thread, or nullptr
+    static const VlThreadPool* poolp() { return t_poolp; }
+
     // METHODS
     template <bool N_SpinWait>
     void dequeWork(ExecRec* workp) VL_MT_SAFE_EXCLUDES(m_mutex) {
         // Spin for a while, waiting for new data
         if VL_CONSTEXPR_CXX17 (N_SpinWait) {
-            for (unsigned i = 0; i < VL_LOCK_SPINS; ++i) {
+            const uint32_t spins = m_contextp->threadsSpinBudget();
+            for (uint32_t i = 0; i < spins; ++i) {
                 if (VL_LIKELY(m_ready_size.load(std::memory_order_relaxed))) break;
                 VL_CPU_RELAX();
             }
@@ -194,7 +359,8 @@ public:
     void wait();  // Blocks calling thread until all tasks complete in this thread
 
     void workerLoop();
-    static void startWorker(VlWorkerThread* workerp, VerilatedContext* contextp);
+    static void startWorker(VlWorkerThread* workerp, VerilatedContext* contextp,
+                            const VlThreadPool* poolp, unsigned index);
 };
 
 class VlThreadPool final : public VerilatedVirtualBase {
@@ -208,6 +374,23 @@ class VlThreadPool final : public VerilatedVirtualBase {
     std::atomic<unsigned> m_assignedTasks{0};
     std::string m_numaStatus;  // Status of NUMA assignment
 
+    // Dynamic scheduling state, see --threads-dynamic.
+    // One deque per worker, the deque after the last worker is the main thread's.
+    std::vector<std::unique_ptr<VlWorkStealDeque>> m_stealDeques;
+    VlSelfP m_stealSelfp = nullptr;  // Symbol table the stolen tasks run on
+    bool m_stealEvenCycle = false;  // Even/odd cycle the stolen tasks run on
+    const VlMTaskVertex* m_stealDonep = nullptr;  // Completes when the graph is done
+    size_t m_stealNDeques = 0;  // Deques in use by the running graph
+    std::atomic<unsigned> m_stealersActive{0};  // Workers still in stealLoop
+    std::atomic<unsigned> m_stealNextIndex{0};  // Next deque index for a joining worker
+    // Incremented on each push of a ready task, so threads may sleep on it
+    std::atomic<uint32_t> m_stealWork{0};
+    std::atomic<uint32_t> m_stealParked{0};  // Threads sleeping on m_stealWork
+    std::atomic<uint64_t> m_steals{0};  // Statistics
+    std::atomic<uint64_t> m_stealParks{0};  // Statistics
+    static thread_local VlWorkStealDeque* t_stealDequep;  // Deque of the running thread
+    static thread_local VlThreadPool* t_stealPoolp;  // Pool of the running thread
+
 public:
     // CONSTRUCTORS
     // Construct a thread pool with 'nThreads' dedicated threads. The thread
@@ -238,12 +421,91 @@ public:
         return m_workers[index];
     }
 
+    uint64_t steals() const { return m_steals; }
+    uint64_t stealParks() const { return m_stealParks; }
+
+    // Dynamic scheduling (--threads-dynamic). Generated code calls stealBegin,
+    // then stealPush for each mtask without upstream dependencies, then
+    // stealRun.  Each mtask calls stealReady for downstream mtasks it makes
+    // ready, and signals 'doneVertex' when it completes.
+    void stealBegin(VlSelfP selfp, bool evenCycle, size_t nTasks);
+    // Seed an initially ready task onto the deque of the given thread, as
+    // statically scheduled. 'index' == number of workers is the main thread.
+    void stealPush(size_t index, VlExecFnp fnp) {
+        assert(index < m_stealDeques.size());
+        m_stealDeques[index]->push(fnp);
+    }
+    // Execute the graph on 'nWorkers' workers and the calling thread;
+    // returns when 'doneVertex' has seen all mtasks finish.
+    void stealRun(unsigned nWorkers, const VlMTaskVertex& doneVertex);
+    // Called from a running mtask, after signalUpstreamDone made 'fnp' ready
+    static void stealReady(VlExecFnp fnp) {
+        // Synchronize with all upstream mtasks, not just the one that made it ready
+        std::atomic_thread_fence(std::memory_order_acquire);
+        t_stealDequep->push(fnp);
+        t_stealPoolp->stealNotify();
+    }
+
 private:
     VL_UNCOPYABLE(VlThreadPool);
 
+    static void stealLoopTask(VlSelfP poolp, bool);
+    void stealLoop(size_t index);
+    // After the spin budget is spent, sleep until a task is pushed or the graph is done
+    void stealPark(size_t nDeques);
+    void stealNotify() {
+        // Sequentially consistent, so either a parking thread sees the new
+        // generation, or we see it in m_stealParked
+        m_stealWork.fetch_add(1, std::memory_order_seq_cst);
+        if (VL_UNLIKELY(m_stealParked.load(std::memory_order_seq_cst))) stealWake();
+    }
+    void stealWake();
+
     // cppcheck-suppress unusedPrivateFunction
     static bool isNumactlRunning();
     std::string numaAssign();
+    std::string cpuListAssign(const std::vector<unsigned>& cpus);
+};
+
+//=============================================================================
+// VlCoverageShards - Coverage counters with --coverage-per-thread
+//
+// Each thread that may evaluate the model increments its own shard of the
+// counters, selected by VlWorkerThread::threadNumber(), so increments need
+// no atomics and threads do not share cache lines.  The shards are summed
+// by VerilatedCovContext when writing.  A thread that is not a worker of
+// the model's own pool, e.g. a worker of another model calling it via DPI,
+// uses shard 0, like the thread calling eval().
+
+class VlCoverageShards final {
+    // MEMBERS
+    std::unique_ptr<uint32_t[]> m_countsp;  // Counters, all of shard 0, then shard 1...
+    const VlThreadPool* const m_poolp;  // Pool whose workers have their own shards
+    const size_t m_stride;  // Counters per shard, padded to whole cache lines
+    const size_t m_shards;  // Number of shards, one per worker thread, plus one
+
+public:
+    // CONSTRUCTORS
+    VlCoverageShards(size_t counters, VlThreadPool* poolp)
+        : m_poolp{poolp}
+        , m_stride{(counters + VL_CACHE_LINE_BYTES / sizeof(uint32_t) - 1)
+                   & ~(VL_CACHE_LINE_BYTES / sizeof(uint32_t) - 1)}
+        , m_shards{static_cast<size_t>(poolp->numThreads()) + 1} {
+        m_countsp.reset(new uint32_t[m_stride * m_shards]());
+    }
+    VL_UNCOPYABLE(VlCoverageShards);
+
+    // METHODS
+    // Counter in the calling thread's shard
+    uint32_t& operator[](size_t index) {
+        const size_t shard
+            = VL_LIKELY(VlWorkerThread::poolp() == m_poolp) ? VlWorkerThread::threadNumber() : 0;
+        return m_countsp[shard * m_stride + index];
+    }
+    // Counter in shard 0, for VerilatedCovContext
+    uint32_t* basep(size_t index) { return &m_countsp[index]; }
+    size_t stride() const { return m_stride; }
+    size_t shards() const { return m_shards; }
 };
 
 #endif
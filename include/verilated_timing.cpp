@@ -59,10 +59,14 @@ void VlDelayScheduler::resume() {
 #endif
     bool resumed = false;
 
-    while (!m_queue.empty() && (m_queue.cbegin()->first == m_context.time())) {
-        VlCoroutineHandle handle = std::move(m_queue.begin()->second);
-        m_queue.erase(m_queue.begin());
-        handle.resume();
+    if (!m_queue.empty() && (m_queue.cbegin()->first == m_context.time())) {
+        // Take the slot out of the queue first, as resumed coroutines add
+        // themselves to the queue again
+        VlDelaySlots::node_type node = m_queue.extract(m_queue.begin());
+        m_lastSlotIt = m_queue.end();
+        for (VlCoroutineHandle& handle : node.mapped()) handle.resume();
+        node.mapped().clear();
+        m_freeSlots.push_back(std::move(node));
         resumed = true;
     }
 
@@ -105,9 +109,11 @@ void VlDelayScheduler::dump() const {
                         m_context.time());
             susp.dump();
         }
-        for (const auto& susp : m_queue) {
-            VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", susp.first);
-            susp.second.dump();
+        for (const auto& slot : m_queue) {
+            for (const VlCoroutineHandle& susp : slot.second) {
+                VL_DBG_MSGF("             Awaiting time %" PRIu64 ": ", slot.first);
+                susp.dump();
+            }
         }
     }
 }
@@ -224,6 +230,49 @@ void VlForkSync::done(const char* filename, int lineno) {
     if (m_join->m_counter == 0) m_join->m_susp.resume();
 }
 
+//======================================================================
+// VlCoroutineFramePool:: Methods
+
+thread_local VlCoroutineFramePool::ThreadPool VlCoroutineFramePool::t_pool{};
+
+void* VlCoroutineFramePool::allocate(size_t size) {
+    ThreadPool& pool = t_pool;
+    ++pool.m_allocs;
+    pool.m_maxSize = std::max(pool.m_maxSize, size);
+    const size_t sizeClass = (size - 1) / GRANULE;
+    if (VL_UNLIKELY(sizeClass >= CLASSES)) return ::operator new(size);
+    if (FreeFrame* const framep = pool.m_freeps[sizeClass]) {
+        pool.m_freeps[sizeClass] = framep->m_nextp;
+        pool.m_cachedBytes -= (sizeClass + 1) * GRANULE;
+        ++pool.m_reuses;
+        return framep;
+    }
+    return ::operator new((sizeClass + 1) * GRANULE);
+}
+
+void VlCoroutineFramePool::deallocate(void* framep, size_t size) VL_MT_SAFE {
+    ThreadPool& pool = t_pool;
+    const size_t sizeClass = (size - 1) / GRANULE;
+    if (VL_UNLIKELY(sizeClass >= CLASSES
+                    || pool.m_cachedBytes + (sizeClass + 1) * GRANULE > MAX_CACHED_BYTES)) {
+        ::operator delete(framep);
+        return;
+    }
+    FreeFrame* const freep = static_cast<FreeFrame*>(framep);
+    freep->m_nextp = pool.m_freeps[sizeClass];
+    pool.m_freeps[sizeClass] = freep;
+    pool.m_cachedBytes += (sizeClass + 1) * GRANULE;
+}
+
+void VlCoroutineFramePool::statsPrint(const VerilatedContext* contextp) VL_MT_UNSAFE {
+    const ThreadPool& pool = t_pool;
+    if (contextp->quiet() || !pool.m_allocs) return;
+    VL_PRINTF("- Verilator: coroutine frames %" PRIu64 "; reused %0.1f%%; largest %" PRIu64
+              " bytes\n",
+              pool.m_allocs, 100.0 * pool.m_reuses / pool.m_allocs,
+              static_cast<uint64_t>(pool.m_maxSize));
+}
+
 //======================================================================
 // VlCoroutine:: Methods
 
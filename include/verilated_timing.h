@@ -27,6 +27,7 @@
 
 #include "verilated.h"
 
+#include <map>
 #include <vector>
 
 // clang-format off
@@ -162,22 +163,54 @@ enum class VlDelayPhase : bool { ACTIVE, INACTIVE };
 
 class VlDelayScheduler final {
     // TYPES
-    // Time-sorted queue of timestamps and handles
-    using VlDelayedCoroutineQueue = std::multimap<uint64_t, VlCoroutineHandle>;
+    // Coroutines awaiting the same simulation time, in order of suspension
+    using VlDelaySlot = std::vector<VlCoroutineHandle>;
+    // Time-sorted slots. As many processes usually await the same few times,
+    // a delay is mostly an append to an existing slot.  Resumed slots are kept
+    // in a pool, with their map node and vector storage, for reuse by later
+    // times, so once warmed up delays do not allocate.
+    using VlDelaySlots = std::map<uint64_t, VlDelaySlot>;
 
     // MEMBERS
     VerilatedContext& m_context;
-    VlDelayedCoroutineQueue m_queue;  // Coroutines to be restored at a certain simulation time
+    VlDelaySlots m_queue;  // Coroutines to be restored at a certain simulation time
+    std::vector<VlDelaySlots::node_type> m_freeSlots;  // Pool of resumed, empty slots
+    VlDelaySlots::iterator m_lastSlotIt = m_queue.end();  // Slot of last delay, else end()
     std::vector<VlCoroutineHandle> m_zeroDelayed;  // Coroutines waiting for #0
     std::vector<VlCoroutineHandle> m_zeroDlyResumed;  // Coroutines that waited for #0 and are
                                                       // to be resumed. Kept as a field to avoid
                                                       // reallocation.
 
+    VL_UNCOPYABLE(VlDelayScheduler);
+
 public:
     // CONSTRUCTORS
     explicit VlDelayScheduler(VerilatedContext& context)
         : m_context{context} {}
+
+private:
     // METHODS
+    // Add a coroutine to resume at the given time
+    void schedule(uint64_t time, VlCoroutineHandle&& handle) {
+        // Consecutive delays, e.g. by processes in the same time slot with the
+        // same delay, mostly await the same time, so try the last slot first
+        if (VL_UNLIKELY(m_lastSlotIt == m_queue.end() || m_lastSlotIt->first != time)) {
+            m_lastSlotIt = m_queue.lower_bound(time);
+            if (m_lastSlotIt == m_queue.end() || m_lastSlotIt->first != time) {
+                if (m_freeSlots.empty()) {
+                    m_lastSlotIt = m_queue.emplace_hint(m_lastSlotIt, time, VlDelaySlot{});
+                } else {
+                    VlDelaySlots::node_type node = std::move(m_freeSlots.back());
+                    m_freeSlots.pop_back();
+                    node.key() = time;
+                    m_lastSlotIt = m_queue.insert(m_lastSlotIt, std::move(node));
+                }
+            }
+        }
+        m_lastSlotIt->second.push_back(std::move(handle));
+    }
+
+public:
     // Resume coroutines waiting for the current simulation time
     void resume();
     // Returns the simulation time of the next time slot (aborts if there are no delayed
@@ -198,7 +231,7 @@ public:
                int lineno = 0) {
         struct Awaitable final {
             VlProcessRef process;  // Data of the suspended process, null if not needed
-            VlDelayedCoroutineQueue& queue;
+            VlDelayScheduler& scheduler;
             std::vector<VlCoroutineHandle>& queueZeroDelay;
             const uint64_t delay;
             const VlDelayPhase phase;
@@ -207,7 +240,7 @@ public:
             bool await_ready() const { return false; }  // Always suspend
             void await_suspend(std::coroutine_handle<> coro) {
                 if (phase == VlDelayPhase::ACTIVE) {
-                    queue.emplace(delay, VlCoroutineHandle{coro, process, fileline});
+                    scheduler.schedule(delay, VlCoroutineHandle{coro, process, fileline});
                 } else {
                     queueZeroDelay.emplace_back(VlCoroutineHandle{coro, process, fileline});
                 }
@@ -224,7 +257,7 @@ public:
         }
 #endif
 
-        return Awaitable{process,       m_queue,
+        return Awaitable{process,       *this,
                          m_zeroDelayed, m_context.time() + delay,
                          phase,         VlFileLineDebug{filename, lineno}};
     }
@@ -415,6 +448,45 @@ public:
     }
 };
 
+//=============================================================================
+// VlCoroutineFramePool
+// Allocator for coroutine frames. Frames are rounded up to a size class, and
+// freed frames are kept on a per-thread free list of their class for reuse,
+// so short-lived processes (e.g. fork..join_none) do not call malloc/free.
+
+class VlCoroutineFramePool final {
+    // CONSTANTS
+    static constexpr size_t GRANULE = 64;  // Size class granularity in bytes
+    static constexpr size_t CLASSES = 64;  // Number of size classes, larger frames use new
+    static constexpr size_t MAX_CACHED_BYTES = 16 * 1024 * 1024;  // Per-thread free list limit
+
+    // TYPES
+    struct FreeFrame final {
+        FreeFrame* m_nextp;  // Next free frame of same size class
+    };
+    // Trivially destructible, so it is cheap to access, and usable while
+    // frames are freed during exit. Free frames of exited threads are not
+    // returned to the heap, but are limited by MAX_CACHED_BYTES.
+    struct ThreadPool final {
+        FreeFrame* m_freeps[CLASSES];  // Free frames of each size class
+        size_t m_cachedBytes;  // Bytes in free frames
+        uint64_t m_allocs;  // Statistics: Frames allocated
+        uint64_t m_reuses;  // Statistics: Frames allocated from free lists
+        size_t m_maxSize;  // Statistics: Largest frame
+    };
+
+    // MEMBERS
+    static thread_local ThreadPool t_pool;
+
+public:
+    // METHODS
+    static void* allocate(size_t size);
+    static void deallocate(void* framep, size_t size) VL_MT_SAFE;
+    // Print frame statistics of the calling thread, as that usually runs all processes.
+    // Called by the --main generated main, not by VerilatedContext::statsPrintSummary.
+    static void statsPrint(const VerilatedContext* contextp) VL_MT_UNSAFE;
+};
+
 //=============================================================================
 // VlCoroutine
 // Return value of a coroutine. Used for chaining coroutine suspension/resumption.
@@ -428,6 +500,12 @@ private:
 
         ~VlPromise();
 
+        // Allocate coroutine frames from the pool
+        static void* operator new(size_t size) { return VlCoroutineFramePool::allocate(size); }
+        static void operator delete(void* framep, size_t size) {
+            VlCoroutineFramePool::deallocate(framep, size);
+        }
+
         VlCoroutine get_return_object() { return {this}; }
 
         // Never suspend at the start of the coroutine
@@ -190,6 +190,10 @@ class VerilatedTraceBaseC VL_NOT_FINAL {
 public:
     /// True if file currently open
     virtual bool isOpen() const VL_MT_SAFE = 0;
+    /// Open the file; call isOpen() to see if errors
+    virtual void open(const char* /*filename*/) VL_MT_SAFE {}
+    /// Close the file, if open
+    virtual void close() VL_MT_SAFE {}
 
     // internal use only
     bool modelConnected() const VL_MT_SAFE { return m_modelConnected; }
@@ -268,8 +272,19 @@ private:
             , m_bufp{bufp} {}
     };
 
+    // Work items shared by all threads formatting trace buffers in parallel
+    struct ParallelWork final {
+        std::vector<ParallelWorkerData*> m_items;  // Work items, in signal code order
+        std::atomic<size_t> m_next{0};  // Index of next item to take
+        std::atomic<unsigned> m_active{0};  // Number of pool workers still taking items
+    };
+
     // Passed a ParallelWorkerData*, second argument is ignored
     static void parallelWorkerTask(void*, bool);
+    // Run work items until none are left
+    static void parallelDrain(ParallelWork& work);
+    // Passed a ParallelWork*, second argument is ignored
+    static void parallelDrainTask(void*, bool);
 
 protected:
     uint32_t* m_sigs_oldvalp = nullptr;  // Previous value store
@@ -295,6 +310,8 @@ private:
     double m_timeUnit = 1e-0;  // Time units (ns/ms etc)
     uint64_t m_timeLastDump = 0;  // Last time we did a dump
     bool m_didSomeDump = false;  // Did at least one dump (i.e.: m_timeLastDump is valid)
+    uint64_t m_checkpointInterval = 0;  // Time between forced full dumps (0 = never)
+    uint64_t m_checkpointNextTime = 0;  // Time at or after which to force a full dump
     VerilatedContext* m_contextp = nullptr;  // The context used by the traced models
     std::set<const VerilatedModel*> m_models;  // The collection of models being traced
 
@@ -358,6 +375,8 @@ protected:
     uint32_t maxBits() const { return m_maxBits; }
     void constDump(bool value) { m_constDump = value; }
     void fullDump(bool value) { m_fullDump = value; }
+    // Force a full dump, including const signals, at least every 'value' time units
+    void checkpointInterval(uint64_t value) { m_checkpointInterval = value; }
 
     double timeRes() const { return m_timeRes; }
     double timeUnit() const { return m_timeUnit; }
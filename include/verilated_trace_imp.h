@@ -452,6 +452,22 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::parallelWorkerTask(void* datap, bool) {
     if (wdp->m_waiting) wdp->m_cv.notify_one();
 }
 
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::parallelDrain(ParallelWork& work) {
+    const size_t nItems = work.m_items.size();
+    for (size_t i = work.m_next.fetch_add(1, std::memory_order_relaxed); i < nItems;
+         i = work.m_next.fetch_add(1, std::memory_order_relaxed)) {
+        parallelWorkerTask(work.m_items[i], false);
+    }
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::parallelDrainTask(void* datap, bool) {
+    ParallelWork* const workp = reinterpret_cast<ParallelWork*>(datap);
+    parallelDrain(*workp);
+    workp->m_active.fetch_sub(1, std::memory_order_release);
+}
+
 template <>
 VL_ATTR_NOINLINE void VerilatedTrace<VL_SUB_T, VL_BUF_T>::ParallelWorkerData::wait() {
     // Spin for a while, waiting for the buffer to become ready
@@ -473,36 +489,35 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runCallbacks(const std::vector<Callback
         VlThreadPool* threadPoolp = static_cast<VlThreadPool*>(m_contextp->threadPoolp());
         // List of work items for thread (std::list, as ParallelWorkerData is not movable)
         std::list<ParallelWorkerData> workerData;
-        // We use the whole pool + the main thread
-        const unsigned threads = threadPoolp->numThreads() + 1;
-        // Main thread executes all jobs with index % threads == 0
-        std::vector<ParallelWorkerData*> mainThreadWorkerData;
-        // Enqueue all the jobs
+        ParallelWork work;
+        // Create all the jobs
         for (const CallbackRecord& cbr : cbVec) {
             // Always get the trace buffer on the main thread
             Buffer* const bufp = getTraceBuffer(cbr.m_fidx);
             // Create new work item
             workerData.emplace_back(cbr.m_dumpCb, cbr.m_userp, bufp);
-            // Grab the new work item
-            ParallelWorkerData* const itemp = &workerData.back();
-            // Enqueue task to thread pool, or main thread
-            if (unsigned rem = cbr.m_fidx % threads) {
-                threadPoolp->workerp(rem - 1)->addTask(parallelWorkerTask, itemp);
-            } else {
-                mainThreadWorkerData.push_back(itemp);
-            }
+            work.m_items.push_back(&workerData.back());
         }
-        // Execute main thread jobs
-        for (ParallelWorkerData* const itemp : mainThreadWorkerData) {
-            parallelWorkerTask(itemp, false);
+        // There are several callbacks per thread, of unequal cost, so rather than
+        // assigning them statically, the whole pool + the main thread take the next
+        // unformatted one whenever they become idle.
+        const size_t nItems = work.m_items.size();
+        const unsigned nWorkers = static_cast<unsigned>(
+            std::min<size_t>(threadPoolp->numThreads(), nItems ? nItems - 1 : 0));
+        work.m_active.store(nWorkers, std::memory_order_relaxed);
+        for (unsigned i = 0; i < nWorkers; ++i) {
+            threadPoolp->workerp(i)->addTask(parallelDrainTask, &work);
         }
-        // Commit all trace buffers in order
+        parallelDrain(work);
+        // Commit all trace buffers in signal code order
         for (ParallelWorkerData& item : workerData) {
             // Wait until ready
             item.wait();
             // Commit the buffer
             commitTraceBuffer(item.m_bufp);
         }
+        // Wait for the workers to stop looking at 'work' before it goes away
+        while (work.m_active.load(std::memory_order_acquire)) VL_CPU_RELAX();
 
         // Done
         return;
@@ -541,6 +556,13 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUD
     m_timeLastDump = timeui;
     m_didSomeDump = true;
 
+    // Periodic checkpoint, so a reader can start from here without earlier data
+    if (VL_UNLIKELY(m_checkpointInterval && timeui >= m_checkpointNextTime)) {
+        m_checkpointNextTime = (timeui / m_checkpointInterval + 1) * m_checkpointInterval;
+        m_constDump = true;
+        m_fullDump = true;
+    }
+
     Verilated::quiesce();
 
     // Call hook for format-specific behaviour
@@ -61,6 +61,10 @@ constexpr unsigned VL_TRACE_MAX_VCD_CODE_SIZE = 5;  // Maximum length of a VCD s
 // cache-lines.
 constexpr unsigned VL_TRACE_SUFFIX_ENTRY_SIZE = 8;  // Size of a suffix entry
 
+// With asynchronous writing, the number of output buffers that may be filled
+// or waiting to be written before the simulation waits for the writer thread.
+constexpr size_t VL_TRACE_VCD_WRITE_BUFFERS = 8;  // Maximum number of output buffers
+
 //=============================================================================
 // Specialization of the generics for this trace format
 
@@ -108,6 +112,11 @@ void VerilatedVcd::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
     if (isOpen()) return;
 
+    // Start the writer thread before anything is written
+    if (m_asyncWrite && !m_writerThreadp) {
+        m_writerThreadp.reset(new std::thread{&VerilatedVcd::writerThreadMain, this});
+    }
+
     // Set member variables
     m_filename = filename;  // "" is ok, as someone may overload open
 
@@ -181,6 +190,16 @@ void VerilatedVcd::openNextImp(bool incFilename) {
     constDump(true);  // First dump must containt the const signals
     fullDump(true);  // First dump must be full
     m_wroteBytes = 0;
+    if (m_indexInterval) {
+        // Offsets in the index are relative to the start of this file
+        m_indexFile.open(m_filename + ".idx", std::ios::out | std::ios::trunc);
+        m_indexPending = true;
+    }
+}
+
+bool VerilatedVcd::preFullDump() {
+    m_indexPending = m_indexFile.is_open();
+    return isOpen();
 }
 
 bool VerilatedVcd::preChangeDump() {
@@ -195,6 +214,8 @@ void VerilatedVcd::emitTimeChange(uint64_t timeui) {
     // be emitted.  Note buffer flushes may still emit a rare duplicate.
     if (m_wrTimeBeginp && m_wrTimeEndp == m_writep) m_writep = m_wrTimeBeginp;
     m_wrTimeBeginp = m_writep;
+    // Offset of the time stamp, before printStr may flush the buffer
+    const uint64_t offset = m_wroteBytes + (m_writep - m_wrBufp);
     {
         printStr("#");
         const std::string str = std::to_string(timeui);
@@ -202,11 +223,18 @@ void VerilatedVcd::emitTimeChange(uint64_t timeui) {
         printStr("\n");
     }
     m_wrTimeEndp = m_writep;
+    if (VL_UNLIKELY(m_indexPending)) {
+        // A full dump follows, so a reader may start at this time stamp
+        m_indexPending = false;
+        m_indexFile << offset << ' ' << timeui << '\n';
+    }
 }
 
 VerilatedVcd::~VerilatedVcd() {
     close();
+    writerShutdown();  // In case the open failed
     if (m_wrBufp) VL_DO_CLEAR(delete[] m_wrBufp, m_wrBufp = nullptr);
+    for (char*& bufp : m_freeWrBuffers) VL_DO_CLEAR(delete[] bufp, bufp = nullptr);
     if (m_filep && m_fileNewed) VL_DO_CLEAR(delete m_filep, m_filep = nullptr);
     if (parallel()) {
         assert(m_numBuffers == m_freeBuffers.size());
@@ -220,8 +248,10 @@ void VerilatedVcd::closePrev() {
 
     Super::flushBase();
     bufferFlush();
+    writerWait();
     m_isOpen = false;
     m_filep->close();
+    if (m_indexFile.is_open()) m_indexFile.close();
 }
 
 void VerilatedVcd::closeErr() {
@@ -240,6 +270,7 @@ void VerilatedVcd::close() VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
     if (!isOpen()) return;
     closePrev();
+    writerShutdown();
     // closePrev() called Super::flush(), so we just
     // need to shut down the tracing thread here.
     Super::closeBase();
@@ -249,6 +280,8 @@ void VerilatedVcd::flush() VL_MT_SAFE_EXCLUDES(m_mutex) {
     const VerilatedLockGuard lock{m_mutex};
     Super::flushBase();
     bufferFlush();
+    writerWait();
+    if (m_indexFile.is_open()) m_indexFile.flush();
 }
 
 void VerilatedVcd::printStr(const char* str) {
@@ -263,6 +296,11 @@ void VerilatedVcd::bufferResize(size_t minsize) {
     // minsize is size of largest write.  We buffer at least 8 times as much data,
     // writing when we are 3/4 full (with thus 2*minsize remaining free)
     if (VL_UNLIKELY(minsize > m_wrChunkSize)) {
+        // Output buffers all have the same size, so drop the smaller written ones
+        writerWait();
+        for (char* const bufp : m_freeWrBuffers) delete[] bufp;
+        m_freeWrBuffers.clear();
+        m_numWrBuffers = 1;
         const char* oldbufp = m_wrBufp;
         m_wrChunkSize = roundUpToMultipleOf<1024>(minsize * 2);
         m_wrBufp = new char[m_wrChunkSize * 8];
@@ -278,21 +316,56 @@ void VerilatedVcd::bufferResize(size_t minsize) {
 }
 
 void VerilatedVcd::bufferFlush() VL_MT_UNSAFE_ONE {
-    // This function can be called from the trace offload thread
     // This function is on the flush() call path
     // We add output data to m_writep.
     // When it gets nearly full we dump it using this routine which calls write()
     // This is much faster than using buffered I/O
     if (VL_UNLIKELY(!m_isOpen)) return;
-    const char* wp = m_wrBufp;
-    while (true) {
-        const ssize_t remaining = (m_writep - wp);
-        if (remaining == 0) break;
+    const size_t len = m_writep - m_wrBufp;
+    if (m_writerThreadp) {
+        if (len) {
+            // Hand the buffer to the writer thread, and continue in another one
+            m_toWriter.put({m_wrBufp, len});
+            ++m_wrBuffersPending;
+            char* bufp;
+            while (m_fromWriter.tryGet(bufp)) {
+                m_freeWrBuffers.push_back(bufp);
+                --m_wrBuffersPending;
+            }
+            if (m_freeWrBuffers.empty()) {
+                if (m_numWrBuffers < VL_TRACE_VCD_WRITE_BUFFERS) {
+                    m_freeWrBuffers.push_back(new char[m_wrChunkSize * 8]);
+                    ++m_numWrBuffers;
+                } else {
+                    // Writer fell behind, wait for it
+                    m_freeWrBuffers.push_back(m_fromWriter.get());
+                    --m_wrBuffersPending;
+                }
+            }
+            m_wrBufp = m_freeWrBuffers.back();
+            m_freeWrBuffers.pop_back();
+            m_wrFlushp = m_wrBufp + m_wrChunkSize * 6;
+        }
+    } else {
+        bufferWrite(m_wrBufp, len);
+    }
+    m_wroteBytes += len;
+
+    // Reset buffer
+    m_writep = m_wrBufp;
+    m_wrTimeBeginp = nullptr;
+    m_wrTimeEndp = nullptr;
+}
+
+void VerilatedVcd::bufferWrite(const char* bufp, size_t len) VL_MT_UNSAFE_ONE {
+    // This function can be called from the writer thread
+    const char* wp = bufp;
+    const char* const endp = bufp + len;
+    while (wp != endp) {
         errno = 0;
-        const ssize_t got = m_filep->write(wp, remaining);
+        const ssize_t got = m_filep->write(wp, endp - wp);
         if (got > 0) {
             wp += got;
-            m_wroteBytes += got;
         } else if (VL_UNCOVERABLE(got < 0)) {
             if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
                 // LCOV_EXCL_START
@@ -305,11 +378,31 @@ void VerilatedVcd::bufferFlush() VL_MT_UNSAFE_ONE {
             }
         }
     }
+}
 
-    // Reset buffer
-    m_writep = m_wrBufp;
-    m_wrTimeBeginp = nullptr;
-    m_wrTimeEndp = nullptr;
+void VerilatedVcd::writerThreadMain() {
+    while (true) {
+        const std::pair<char*, size_t> item = m_toWriter.get();
+        if (!item.first) break;  // Shut down
+        bufferWrite(item.first, item.second);
+        m_fromWriter.put(item.first);
+    }
+}
+
+void VerilatedVcd::writerWait() {
+    // Wait until all buffers handed to the writer thread are written
+    while (m_wrBuffersPending) {
+        m_freeWrBuffers.push_back(m_fromWriter.get());
+        --m_wrBuffersPending;
+    }
+}
+
+void VerilatedVcd::writerShutdown() {
+    if (!m_writerThreadp) return;
+    writerWait();
+    m_toWriter.put({nullptr, 0});
+    m_writerThreadp->join();
+    m_writerThreadp.reset();
 }
 
 //=============================================================================
@@ -597,6 +690,7 @@ void VerilatedVcdBuffer::finishLine(uint32_t code, char* writep) {
             m_owner.m_writep = m_writep;
             m_owner.bufferFlush();
             m_writep = m_owner.m_writep;
+            m_wrFlushp = m_owner.m_wrFlushp;  // Asynchronous writing switches buffers
         }
     }
 }
@@ -24,7 +24,10 @@
 #include "verilated.h"
 #include "verilated_trace.h"
 
+#include <fstream>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 class VerilatedVcdBuffer;
@@ -50,6 +53,9 @@ private:
     bool m_isOpen = false;  // True indicates open file
     std::string m_filename;  // Filename we're writing to (if open)
     uint64_t m_rolloverSize = 0;  // File size to rollover at
+    uint64_t m_indexInterval = 0;  // Time between indexed checkpoints (0 = no index)
+    std::ofstream m_indexFile;  // Index sidecar file, when m_indexInterval
+    bool m_indexPending = false;  // Next time change starts a full dump to index
     int m_indent = 0;  // Indentation depth
 
     char* m_wrBufp;  // Output buffer
@@ -71,8 +77,23 @@ private:
     std::vector<std::pair<char*, size_t>> m_freeBuffers;
     size_t m_numBuffers = 0;  // Number of trace buffers allocated
 
+    // Asynchronous writing. Full output buffers as (pointer, length) pairs are
+    // handed to the writer thread, which returns them when written. All output
+    // buffers have the same size, m_wrChunkSize * 8.
+    bool m_asyncWrite = false;  // Write on a separate thread
+    std::unique_ptr<std::thread> m_writerThreadp;  // Thread writing the file
+    VerilatedThreadQueue<std::pair<char*, size_t>> m_toWriter;  // Buffers to write
+    VerilatedThreadQueue<char*> m_fromWriter;  // Buffers written
+    std::vector<char*> m_freeWrBuffers;  // Written buffers, ready for reuse
+    size_t m_numWrBuffers = 1;  // Number of output buffers allocated
+    size_t m_wrBuffersPending = 0;  // Number of output buffers with the writer thread
+
     void bufferResize(size_t minsize);
     void bufferFlush() VL_MT_UNSAFE_ONE;
+    void bufferWrite(const char* bufp, size_t len) VL_MT_UNSAFE_ONE;
+    void writerThreadMain();
+    void writerWait();
+    void writerShutdown();
     void bufferCheck() {
         // Flush the write buffer if there's not enough space left for new information
         // We only call this once per vector, so we need enough slop for a very wide "b###" line
@@ -97,7 +118,7 @@ protected:
     void emitTimeChange(uint64_t timeui) override;
 
     // Hooks called from VerilatedTrace
-    bool preFullDump() override { return isOpen(); }
+    bool preFullDump() override;
     bool preChangeDump() override;
 
     // Trace buffer management
@@ -118,6 +139,14 @@ public:
     // ACCESSORS
     // Set size in bytes after which new file should be created.
     void rolloverSize(uint64_t size) VL_MT_SAFE { m_rolloverSize = size; }
+    // Write the file from a separate thread. Must be called before open().
+    void asyncWrite(bool flag) VL_MT_SAFE { m_asyncWrite = flag; }
+    // Write a full dump at least every 'interval' time units, and index them in
+    // a sidecar file. Must be called before open().
+    void indexInterval(uint64_t interval) VL_MT_SAFE {
+        m_indexInterval = interval;
+        checkpointInterval(interval);
+    }
 
     // METHODS - All must be thread safe
     // Open the file; call isOpen() to see if errors
@@ -188,7 +217,7 @@ class VerilatedVcdBuffer VL_NOT_FINAL {
     // Write pointer into output buffer (in parallel mode, this is set up in 'getTraceBuffer')
     char* m_writep = m_owner.parallel() ? nullptr : m_owner.m_writep;
     // Output buffer flush trigger location (only used when not parallel)
-    char* const m_wrFlushp = m_owner.parallel() ? nullptr : m_owner.m_wrFlushp;
+    char* m_wrFlushp = m_owner.parallel() ? nullptr : m_owner.m_wrFlushp;
 
     // VCD line end string codes + metadata
     const char* const m_suffixes = m_owner.m_suffixes.data();
@@ -273,7 +302,7 @@ public:
     /// Open a new VCD file
     /// This includes a complete header dump each time it is called,
     /// just as if this object was deleted and reconstructed.
-    virtual void open(const char* filename) VL_MT_SAFE { m_sptrace.open(filename); }
+    void open(const char* filename) override VL_MT_SAFE { m_sptrace.open(filename); }
     /// Continue a VCD dump by rotating to a new file name
     /// The header is only in the first file created, this allows
     /// "cat" to be used to combine the header plus any number of data files.
@@ -284,8 +313,18 @@ public:
     /// alignment to a start of a given time's dump).  Any file but the
     /// first may be removed.  Cat files together to create viewable vcd.
     void rolloverSize(size_t size) VL_MT_SAFE { m_sptrace.rolloverSize(size); }
+    /// Write the file from a separate thread, so the simulation does not
+    /// wait for the disk unless the writer falls behind.  Must be called
+    /// before open().
+    void asyncWrite(bool flag) VL_MT_SAFE { m_sptrace.asyncWrite(flag); }
+    /// Write a full dump of every signal at least every 'interval' time
+    /// units, and write an index of those checkpoints to '<filename>.idx',
+    /// one '<byte offset> <time>' line per checkpoint.  A viewer can start
+    /// reading at any indexed offset without the earlier file contents.
+    /// Must be called before open().
+    void indexInterval(uint64_t interval) VL_MT_SAFE { m_sptrace.indexInterval(interval); }
     /// Close dump
-    void close() VL_MT_SAFE {
+    void close() override VL_MT_SAFE {
         m_sptrace.close();
         modelConnected(false);
     }
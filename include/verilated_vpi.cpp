@@ -33,12 +33,15 @@
 
 #include "vltstd/vpi_user.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
+#include <deque>
 #include <list>
 #include <map>
-#include <set>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -345,7 +348,6 @@ public:
 };
 
 class VerilatedVpioVar VL_NOT_FINAL : public VerilatedVpioVarBase {
-    uint8_t* m_prevDatap = nullptr;  // Previous value of data, for cbValueChange
     union {
         uint8_t u8[4];
         uint32_t u32;
@@ -371,14 +373,11 @@ public:
             m_entSize = varp->m_entSize;
             m_varDatap = varp->m_varDatap;
             m_index = varp->m_index;
-            // Not copying m_prevDatap, must be nullptr
         } else {
             m_mask.u32 = 0;
         }
     }
-    ~VerilatedVpioVar() override {
-        if (m_prevDatap) VL_DO_CLEAR(delete[] m_prevDatap, m_prevDatap = nullptr);
-    }
+    ~VerilatedVpioVar() override = default;
     static VerilatedVpioVar* castp(vpiHandle h) {
         return dynamic_cast<VerilatedVpioVar*>(reinterpret_cast<VerilatedVpio*>(h));
     }
@@ -424,14 +423,7 @@ public:
         for (auto idx : index()) t_out += "[" + std::to_string(idx) + "]";
         return t_out.c_str();
     }
-    void* prevDatap() const { return m_prevDatap; }
     void* varDatap() const override { return m_varDatap; }
-    void createPrevDatap() {
-        if (VL_UNLIKELY(!m_prevDatap)) {
-            m_prevDatap = new uint8_t[entSize()];
-            std::memcpy(prevDatap(), varp()->datap(), entSize());
-        }
-    }
 };
 
 class VerilatedVpioVarIter final : public VerilatedVpio {
@@ -700,7 +692,6 @@ public:
         m_cbData.value = &m_value;
         if (varop) {
             m_cbData.obj = m_varo.castVpiHandle();
-            m_varo.createPrevDatap();
         } else {
             m_cbData.obj = nullptr;
         }
@@ -877,6 +868,57 @@ class VerilatedVpiImp final {
     VpioFutureCbs m_futureCbs;  // Time based callbacks for future timestamps
     VpioFutureCbs m_nextCbs;  // cbNextSimTime callbacks
     std::list<VerilatedVpiPutHolder> m_inertialPuts;  // Pending vpi puts due to vpiInertialDelay
+    // cbValueChange callbacks grouped by the data they watch, so each value is compared once
+    struct ValueWatch final {
+        std::vector<uint8_t> m_prev;  // Value when last compared
+        std::vector<VerilatedVpiCbHolder*> m_holders;  // Callbacks on this value, in id order
+        // Callbacks added while the value differed from m_prev, each with the value at
+        // registration. They join m_holders once m_prev is refreshed.
+        std::vector<std::pair<VerilatedVpiCbHolder*, std::vector<uint8_t>>> m_joining;
+        bool unwatched() const {
+            return std::all_of(m_holders.begin(), m_holders.end(),
+                               [](const VerilatedVpiCbHolder* hop) { return hop->invalid(); })
+                   && std::all_of(m_joining.begin(), m_joining.end(),
+                                  [](const std::pair<VerilatedVpiCbHolder*,
+                                                     std::vector<uint8_t>>& joining) {
+                                      return joining.first->invalid();
+                                  });
+        }
+    };
+    using ValueWatchKey = std::pair<const void*, uint32_t>;  // Data pointer, size
+    std::map<ValueWatchKey, ValueWatch> m_valueWatches;
+    bool m_valueCbsRemoved = false;  // cbValueChange callbacks need cleanup
+
+    // Handles found by vpi_handle_by_name are interned, so repeated lookups of a name
+    // return the same handle. vpi_release_handle leaves them valid. They are freed
+    // when a scope of their context is erased, which makes them stale anyway.
+    // Key into NameCache, so lookups need not allocate a std::string
+    struct NameKey final {
+        const char* m_namep;
+        size_t m_len;
+    };
+    struct NameKeyHash final {
+        size_t operator()(const NameKey& key) const {
+            uint64_t hash = 14695981039346656037ULL;  // FNV-1a
+            for (size_t i = 0; i < key.m_len; ++i) {
+                hash ^= static_cast<uint8_t>(key.m_namep[i]);
+                hash *= 1099511628211ULL;
+            }
+            return static_cast<size_t>(hash);
+        }
+    };
+    struct NameKeyEqual final {
+        bool operator()(const NameKey& a, const NameKey& b) const {
+            return a.m_len == b.m_len && std::memcmp(a.m_namep, b.m_namep, a.m_len) == 0;
+        }
+    };
+    struct NameCache final {
+        std::unordered_map<NameKey, VerilatedVpio*, NameKeyHash, NameKeyEqual> m_handles;
+        std::deque<std::string> m_names;  // Storage for m_handles keys
+        uint64_t m_generation = 0;  // Scope generation m_handles are valid for
+    };
+    std::unordered_map<const VerilatedContext*, NameCache> m_nameCaches;  // Per context
+    std::unordered_set<const VerilatedVpio*> m_internedHandles;  // In any m_nameCaches
     VerilatedVpiError* m_errorInfop = nullptr;  // Container for vpi error info
     VerilatedAssertOneThread m_assertOne;  // Assert only called from single thread
     uint64_t m_nextCallbackId = 1;  // Id to identify callback
@@ -901,6 +943,22 @@ public:
         VerilatedVpioVar* varop = nullptr;
         if (cb_data_p->reason == cbValueChange) varop = VerilatedVpioVar::castp(cb_data_p->obj);
         s().m_cbCurrentLists[cb_data_p->reason].emplace_back(id, cb_data_p, varop);
+        if (varop) {
+            VerilatedVpiCbHolder& ho = s().m_cbCurrentLists[cb_data_p->reason].back();
+            const uint8_t* const datap = static_cast<const uint8_t*>(varop->varDatap());
+            ValueWatch& watch = s().m_valueWatches[std::make_pair(datap, varop->entSize())];
+            if (watch.unwatched()) {
+                watch.m_prev.assign(datap, datap + varop->entSize());
+                watch.m_joining.clear();
+            }
+            if (std::memcmp(watch.m_prev.data(), datap, varop->entSize()) == 0) {
+                watch.m_holders.push_back(&ho);
+            } else {
+                // The other callbacks are yet to see a change this one must not see
+                watch.m_joining.emplace_back(
+                    &ho, std::vector<uint8_t>(datap, datap + varop->entSize()));
+            }
+        }
     }
     static void cbFutureAdd(uint64_t id, const s_cb_data* cb_data_p, QData time) {
         // The passed cb_data_p was property of the user, so need to recreate
@@ -926,6 +984,7 @@ public:
         for (auto& ir : s().m_cbCurrentLists[reason]) {
             if (ir.id() == id) {
                 ir.invalidate();
+                if (reason == cbValueChange) s().m_valueCbsRemoved = true;
                 return;  // Once found, it won't also be in m_cbCallList, m_futureCbs, or m_nextCbs
             }
         }
@@ -1007,42 +1066,118 @@ public:
         s().m_cbCallList.clear();
         return called;
     }
+    static VerilatedVpio* nameCacheFind(const char* namep) VL_MT_UNSAFE_ONE {
+        const VerilatedContext* const contextp = Verilated::threadContextp();
+        NameCache& cache = s().m_nameCaches[contextp];
+        const uint64_t generation = contextp->impp()->scopeGeneration();
+        if (VL_UNLIKELY(generation != cache.m_generation)) {
+            // Scopes were removed, so the handles may refer to freed scopes and variables
+            for (const auto& it : cache.m_handles) {
+                s().m_internedHandles.erase(it.second);
+                VL_DO_DANGLING(delete it.second, it.second);
+            }
+            cache.m_handles.clear();
+            cache.m_names.clear();
+            cache.m_generation = generation;
+            return nullptr;
+        }
+        const auto it = cache.m_handles.find(NameKey{namep, std::strlen(namep)});
+        if (it == cache.m_handles.end()) return nullptr;
+        return it->second;
+    }
+    static void nameCacheInsert(const char* namep, VerilatedVpio* vop) VL_MT_UNSAFE_ONE {
+        // After nameCacheFind, so the cache is for the current generation
+        NameCache& cache = s().m_nameCaches[Verilated::threadContextp()];
+        cache.m_names.emplace_back(namep);
+        const std::string& name = cache.m_names.back();
+        cache.m_handles.emplace(NameKey{name.data(), name.size()}, vop);
+        s().m_internedHandles.insert(vop);
+    }
+    static bool isInterned(const VerilatedVpio* vop) VL_MT_UNSAFE_ONE {
+        return s().m_internedHandles.count(vop);
+    }
+    static void cleanupValueCbs() VL_MT_UNSAFE_ONE {
+        // Drop removed cbValueChange callbacks, and values no longer watched
+        s().m_valueCbsRemoved = false;
+        for (auto it = s().m_valueWatches.begin(); it != s().m_valueWatches.end();) {
+            std::vector<VerilatedVpiCbHolder*>& holders = it->second.m_holders;
+            holders.erase(std::remove_if(holders.begin(), holders.end(),
+                                         [](const VerilatedVpiCbHolder* hop) {  //
+                                             return hop->invalid();
+                                         }),
+                          holders.end());
+            auto& joining = it->second.m_joining;
+            joining.erase(
+                std::remove_if(joining.begin(), joining.end(),
+                               [](const std::pair<VerilatedVpiCbHolder*, std::vector<uint8_t>>&
+                                      join) { return join.first->invalid(); }),
+                joining.end());
+            if (holders.empty() && joining.empty()) {
+                it = s().m_valueWatches.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        s().m_cbCurrentLists[cbValueChange].remove_if(
+            [](const VerilatedVpiCbHolder& ho) { return ho.invalid(); });
+    }
     static bool callValueCbs() VL_MT_UNSAFE_ONE {
         assertOneCheck();
-        VpioCbList& cbObjList = s().m_cbCurrentLists[cbValueChange];
-        bool called = false;
-        std::set<VerilatedVpioVar*> update;  // set of objects to update after callbacks
-        if (cbObjList.empty()) return called;
-        const auto last = std::prev(cbObjList.end());  // prevent looping over newly added elements
-        for (auto it = cbObjList.begin(); true;) {
-            // cbReasonRemove sets to nullptr, so we know on removal the old end() will still exist
-            const bool was_last = it == last;
-            if (VL_UNLIKELY(it->invalid())) {  // Deleted earlier, cleanup
-                it = cbObjList.erase(it);
-                if (was_last) break;
-                continue;
+        if (VL_UNLIKELY(s().m_valueCbsRemoved)) cleanupValueCbs();
+        // Compare each watched value once, and collect the callbacks on those that changed
+        std::vector<std::pair<const ValueWatchKey, ValueWatch>*> changed;
+        std::vector<VerilatedVpiCbHolder*> holders;
+        bool joined = false;
+        for (auto& it : s().m_valueWatches) {
+            const void* const newDatap = it.first.first;
+            ValueWatch& watch = it.second;
+            VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_test v[0]=%d/%d %p\n",
+                                        *(static_cast<const CData*>(newDatap)),
+                                        *(static_cast<const CData*>(watch.m_prev.data())),
+                                        newDatap););
+            if (VL_UNLIKELY(!watch.m_joining.empty())) {
+                // Compare against the value each joining callback was registered at
+                joined = true;
+                for (const auto& join : watch.m_joining) {
+                    if (std::memcmp(join.second.data(), newDatap, join.second.size()) != 0) {
+                        holders.push_back(join.first);
+                    }
+                }
             }
-            VerilatedVpiCbHolder& ho = *it++;
-            VerilatedVpioVar* const varop
-                = reinterpret_cast<VerilatedVpioVar*>(ho.cb_datap()->obj);
-            void* const newDatap = varop->varDatap();
-            void* const prevDatap = varop->prevDatap();  // Was malloced when we added the callback
-            VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_test %s v[0]=%d/%d %p %p\n",
-                                        varop->fullname(), *(static_cast<CData*>(newDatap)),
-                                        *(static_cast<CData*>(prevDatap)), newDatap, prevDatap););
-            if (std::memcmp(prevDatap, newDatap, varop->entSize()) != 0) {
-                VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: value_callback %" PRId64 " %s v[0]=%d\n",
-                                            ho.id(), varop->fullname(),
-                                            *(static_cast<CData*>(newDatap))););
-                update.insert(varop);
-                vpi_get_value(ho.cb_datap()->obj, ho.cb_datap()->value);
-                (ho.cb_rtnp())(ho.cb_datap());
-                called = true;
+            if (std::memcmp(watch.m_prev.data(), newDatap, watch.m_prev.size()) == 0) continue;
+            changed.push_back(&it);
+            holders.insert(holders.end(), watch.m_holders.begin(), watch.m_holders.end());
+        }
+        // All of m_prev now match their values, so joining callbacks may use them
+        if (VL_UNLIKELY(joined)) {
+            for (auto& it : s().m_valueWatches) {
+                ValueWatch& watch = it.second;
+                for (const auto& join : watch.m_joining) watch.m_holders.push_back(join.first);
+                watch.m_joining.clear();
             }
-            if (was_last) break;
         }
-        for (const auto& ip : update) {
-            std::memcpy(ip->prevDatap(), ip->varDatap(), ip->entSize());
+        if (holders.empty()) return false;
+        // Call in registration order, and not any callbacks added by the callbacks
+        if (changed.size() > 1 || joined) {
+            std::sort(holders.begin(), holders.end(),
+                      [](const VerilatedVpiCbHolder* ap, const VerilatedVpiCbHolder* bp) {
+                          return ap->id() < bp->id();
+                      });
+        }
+        bool called = false;
+        for (VerilatedVpiCbHolder* const hop : holders) {
+            if (VL_UNLIKELY(hop->invalid())) continue;  // Removed by an earlier callback
+            VL_DEBUG_IF_PLI(VerilatedVpioVar* const varop
+                            = reinterpret_cast<VerilatedVpioVar*>(hop->cb_datap()->obj);
+                            VL_DBG_MSGF("- vpi: value_callback %" PRId64 " %s v[0]=%d\n",
+                                        hop->id(), varop->fullname(),
+                                        *(static_cast<CData*>(varop->varDatap()))););
+            vpi_get_value(hop->cb_datap()->obj, hop->cb_datap()->value);
+            (hop->cb_rtnp())(hop->cb_datap());
+            called = true;
+        }
+        for (auto* const itp : changed) {
+            std::memcpy(itp->second.m_prev.data(), itp->first.first, itp->second.m_prev.size());
         }
         return called;
     }
@@ -2050,80 +2185,90 @@ void vpi_get_systf_info(vpiHandle /*object*/, p_vpi_systf_data /*systf_data_p*/)
 
 // for obtaining handles
 
+static bool vl_vpi_resolve_name(const std::string& scopeAndName,
+                                const VerilatedScope*& scopep, const VerilatedVar*& varp) {
+    // This doesn't yet follow the hierarchy in the proper way
+    varp = nullptr;
+    bool isPackage = false;
+    scopep = Verilated::threadContextp()->scopeFind(scopeAndName.c_str());
+    if (scopep) return true;  // Whole thing found as a scope
+    std::string basename = scopeAndName;
+    std::string scopename;
+    std::string::size_type prevpos = std::string::npos;
+    std::string::size_type pos = std::string::npos;
+    // Split hierarchical names at last '.' not inside escaped identifier
+    size_t i = 0;
+    while (i < scopeAndName.length()) {
+        if (scopeAndName[i] == '\\') {
+            while (i < scopeAndName.length() && scopeAndName[i] != ' ') ++i;
+            ++i;  // Proc ' ', it should always be there. Then grab '.' on next cycle
+        } else {
+            while (i < scopeAndName.length()
+                   && (scopeAndName[i] != '.'
+                       && (i + 1 >= scopeAndName.length() || scopeAndName[i] != ':'
+                           || scopeAndName[i + 1] != ':')))
+                ++i;
+            if (i < scopeAndName.length()) {
+                prevpos = pos;
+                pos = i++;
+                if (scopeAndName[i - 1] == ':') isPackage = true;
+            }
+        }
+    }
+    // Do the split
+    if (VL_LIKELY(pos != std::string::npos)) {
+        basename.erase(0, pos + (isPackage ? 2 : 1));
+        scopename = scopeAndName.substr(0, pos);
+        if (scopename == "$unit") scopename = "\\$unit ";
+    }
+    if (prevpos == std::string::npos) {
+        // scopename is a toplevel (no '.' separator), so search in our TOP ports first.
+        scopep = Verilated::threadContextp()->scopeFind("TOP");
+        if (scopep) varp = scopep->varFind(basename.c_str());
+    }
+    if (!varp) {
+        scopep = Verilated::threadContextp()->scopeFind(scopename.c_str());
+        if (!scopep) return false;
+        varp = scopep->varFind(basename.c_str());
+    }
+    return varp;
+}
+
 vpiHandle vpi_handle_by_name(PLI_BYTE8* namep, vpiHandle scope) {
     VerilatedVpiImp::assertOneCheck();
     VL_VPI_ERROR_RESET_();
     if (VL_UNLIKELY(!namep)) return nullptr;
     VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_handle_by_name %s %p\n", namep, scope););
-    const VerilatedVar* varp = nullptr;
-    const VerilatedScope* scopep;
     const VerilatedVpioScope* const voScopep = VerilatedVpioScope::castp(scope);
-    std::string scopeAndName = namep;
+    std::string scopeAndName;
     if (voScopep) {
         const bool scopeIsPackage = VerilatedVpioPackage::castp(scope) != nullptr;
         scopeAndName = std::string{voScopep->fullname()} + (scopeIsPackage ? "" : ".") + namep;
         namep = const_cast<PLI_BYTE8*>(scopeAndName.c_str());
     }
-    {
-        // This doesn't yet follow the hierarchy in the proper way
-        bool isPackage = false;
-        scopep = Verilated::threadContextp()->scopeFind(namep);
-        if (scopep) {  // Whole thing found as a scope
+    // Repeated lookups of the same name are common, so return the same handle
+    VerilatedVpio* vop = VerilatedVpiImp::nameCacheFind(namep);
+    if (!vop) {
+        if (!voScopep) scopeAndName = namep;
+        const VerilatedScope* scopep;
+        const VerilatedVar* varp;
+        if (!vl_vpi_resolve_name(scopeAndName, scopep /*ref*/, varp /*ref*/)) return nullptr;
+        if (!varp) {
             if (scopep->type() == VerilatedScope::SCOPE_MODULE) {
-                return (new VerilatedVpioModule{scopep})->castVpiHandle();
+                vop = new VerilatedVpioModule{scopep};
             } else if (scopep->type() == VerilatedScope::SCOPE_PACKAGE) {
-                return (new VerilatedVpioPackage{scopep})->castVpiHandle();
-            } else {
-                return (new VerilatedVpioScope{scopep})->castVpiHandle();
-            }
-        }
-        std::string basename = scopeAndName;
-        std::string scopename;
-        std::string::size_type prevpos = std::string::npos;
-        std::string::size_type pos = std::string::npos;
-        // Split hierarchical names at last '.' not inside escaped identifier
-        size_t i = 0;
-        while (i < scopeAndName.length()) {
-            if (scopeAndName[i] == '\\') {
-                while (i < scopeAndName.length() && scopeAndName[i] != ' ') ++i;
-                ++i;  // Proc ' ', it should always be there. Then grab '.' on next cycle
+                vop = new VerilatedVpioPackage{scopep};
             } else {
-                while (i < scopeAndName.length()
-                       && (scopeAndName[i] != '.'
-                           && (i + 1 >= scopeAndName.length() || scopeAndName[i] != ':'
-                               || scopeAndName[i + 1] != ':')))
-                    ++i;
-                if (i < scopeAndName.length()) {
-                    prevpos = pos;
-                    pos = i++;
-                    if (scopeAndName[i - 1] == ':') isPackage = true;
-                }
+                vop = new VerilatedVpioScope{scopep};
             }
+        } else if (varp->isParam()) {
+            vop = new VerilatedVpioParam{varp, scopep};
+        } else {
+            vop = new VerilatedVpioVar{varp, scopep};
         }
-        // Do the split
-        if (VL_LIKELY(pos != std::string::npos)) {
-            basename.erase(0, pos + (isPackage ? 2 : 1));
-            scopename = scopeAndName.substr(0, pos);
-            if (scopename == "$unit") scopename = "\\$unit ";
-        }
-        if (prevpos == std::string::npos) {
-            // scopename is a toplevel (no '.' separator), so search in our TOP ports first.
-            scopep = Verilated::threadContextp()->scopeFind("TOP");
-            if (scopep) varp = scopep->varFind(basename.c_str());
-        }
-        if (!varp) {
-            scopep = Verilated::threadContextp()->scopeFind(scopename.c_str());
-            if (!scopep) return nullptr;
-            varp = scopep->varFind(basename.c_str());
-        }
-    }
-    if (!varp) return nullptr;
-
-    if (varp->isParam()) {
-        return (new VerilatedVpioParam{varp, scopep})->castVpiHandle();
-    } else {
-        return (new VerilatedVpioVar{varp, scopep})->castVpiHandle();
+        VerilatedVpiImp::nameCacheInsert(namep, vop);
     }
+    return vop->castVpiHandle();
 }
 
 vpiHandle vpi_handle_by_index(vpiHandle object, PLI_INT32 indx) {
@@ -3647,6 +3792,8 @@ PLI_INT32 vpi_release_handle(vpiHandle object) {
     VerilatedVpio* const vop = VerilatedVpio::castp(object);
     VL_VPI_ERROR_RESET_();
     if (VL_UNLIKELY(!vop)) return 0;
+    // Shared by vpi_handle_by_name, so stays valid until a model of its context is deleted
+    if (VerilatedVpiImp::isInterned(vop)) return 1;
     VL_DO_DANGLING(delete vop, vop);
     return 1;
 }
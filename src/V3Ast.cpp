@@ -37,15 +37,17 @@ uint64_t AstNode::s_editCntGbl = 0;  // Hot cache line
 // along with each userp, and thus by bumping this count we can make it look
 // as if we iterated across the entire tree to set all the userp's to null.
 int AstNode::s_cloneCntGbl = 0;
-uint32_t VNUser1InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
-uint32_t VNUser2InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
-uint32_t VNUser3InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
-uint32_t VNUser4InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
+thread_local uint32_t VNUser1InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
+thread_local uint32_t VNUser2InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
+thread_local uint32_t VNUser3InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
+thread_local uint32_t VNUser4InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
 
-bool VNUser1InUse::s_userBusy = false;
-bool VNUser2InUse::s_userBusy = false;
-bool VNUser3InUse::s_userBusy = false;
-bool VNUser4InUse::s_userBusy = false;
+std::atomic<uint32_t> VNUserInUseBase::s_userCntLast[5]{};
+
+thread_local bool VNUser1InUse::s_userBusy = false;
+thread_local bool VNUser2InUse::s_userBusy = false;
+thread_local bool VNUser3InUse::s_userBusy = false;
+thread_local bool VNUser4InUse::s_userBusy = false;
 
 int AstNodeDType::s_uniqueNum = 0;
 
@@ -1293,10 +1295,10 @@ void AstNode::dumpPtrs(std::ostream& os) const {
     if (op2p()) os << " op2p=" << cvtToHex(op2p());
     if (op3p()) os << " op3p=" << cvtToHex(op3p());
     if (op4p()) os << " op4p=" << cvtToHex(op4p());
-    if (user1p()) os << " user1p=" << cvtToHex(user1p());
-    if (user2p()) os << " user2p=" << cvtToHex(user2p());
-    if (user3p()) os << " user3p=" << cvtToHex(user3p());
-    if (user4p()) os << " user4p=" << cvtToHex(user4p());
+    if (VNUser1InUse::s_userBusy && user1p()) os << " user1p=" << cvtToHex(user1p());
+    if (VNUser2InUse::s_userBusy && user2p()) os << " user2p=" << cvtToHex(user2p());
+    if (VNUser3InUse::s_userBusy && user3p()) os << " user3p=" << cvtToHex(user3p());
+    if (VNUser4InUse::s_userBusy && user4p()) os << " user4p=" << cvtToHex(user4p());
     if (m_iterpp) {
         os << " iterpp=" << cvtToHex(m_iterpp);
         // This may cause address sanitizer failures as iterpp can be stale
@@ -30,6 +30,7 @@
 
 #include "V3Ast__gen_forward_class_decls.h"  // From ./astgen
 
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <functional>
@@ -1801,8 +1802,17 @@ public:
 //  This will clear the tree, and prevent another visitor from clobbering
 //  user2.  When the member goes out of scope it will be automagically
 //  freed up.
+//
+//  The current user*() epoch and the in use flag are per thread, so
+//  concurrent jobs (e.g. V3ThreadScope::forEachModule) may each hold their
+//  own VNUser*InUse, provided they do not touch the same nodes. Epochs are
+//  drawn from a shared counter, so values set under one thread's epoch read
+//  as cleared on all other threads.
 
 class VNUserInUseBase VL_NOT_FINAL {
+    // Last epoch handed out for each user*(), shared by all threads
+    static std::atomic<uint32_t> s_userCntLast[5];
+
 protected:
     static void allocate(int id, uint32_t& cntGblRef, bool& userBusyRef) {
         // Perhaps there's still a AstUserInUse in scope for this?
@@ -1820,7 +1830,7 @@ protected:
         UASSERT_STATIC(userBusyRef, "Clear of User" + cvtToStr(id) + "() not under AstUserInUse");
         // If this really fires and is real (after 2^32 edits???)
         // we could just walk the tree and clear manually
-        ++cntGblRef;
+        cntGblRef = s_userCntLast[id].fetch_add(1, std::memory_order_relaxed) + 1;
         UASSERT_STATIC(cntGblRef, "User*() overflowed!");
     }
     static void checkcnt(int id, uint32_t&, const bool& userBusyRef) {
@@ -1836,8 +1846,8 @@ protected:
 class VNUser1InUse final : VNUserInUseBase {
 protected:
     friend class AstNode;
-    static uint32_t s_userCntGbl;  // Count of which usage of userp() this is
-    static bool s_userBusy;  // Count is in use
+    static thread_local uint32_t s_userCntGbl;  // Count of which usage of userp() this is
+    static thread_local bool s_userBusy;  // Count is in use
 public:
     VNUser1InUse()      { allocate(1, s_userCntGbl/*ref*/, s_userBusy/*ref*/); }
     ~VNUser1InUse()     { free    (1, s_userCntGbl/*ref*/, s_userBusy/*ref*/); }
@@ -1847,8 +1857,8 @@ public:
 class VNUser2InUse final : VNUserInUseBase {
 protected:
     friend class AstNode;
-    static uint32_t s_userCntGbl;  // Count of which usage of userp() this is
-    static bool s_userBusy;  // Count is in use
+    static thread_local uint32_t s_userCntGbl;  // Count of which usage of userp() this is
+    static thread_local bool s_userBusy;  // Count is in use
 public:
     VNUser2InUse()      { allocate(2, s_userCntGbl/*ref*/, s_userBusy/*ref*/); }
     ~VNUser2InUse()     { free    (2, s_userCntGbl/*ref*/, s_userBusy/*ref*/); }
@@ -1858,8 +1868,8 @@ public:
 class VNUser3InUse final : VNUserInUseBase {
 protected:
     friend class AstNode;
-    static uint32_t s_userCntGbl;  // Count of which usage of userp() this is
-    static bool s_userBusy;  // Count is in use
+    static thread_local uint32_t s_userCntGbl;  // Count of which usage of userp() this is
+    static thread_local bool s_userBusy;  // Count is in use
 public:
     VNUser3InUse()      { allocate(3, s_userCntGbl/*ref*/, s_userBusy/*ref*/); }
     ~VNUser3InUse()     { free    (3, s_userCntGbl/*ref*/, s_userBusy/*ref*/); }
@@ -1869,8 +1879,8 @@ public:
 class VNUser4InUse final : VNUserInUseBase {
 protected:
     friend class AstNode;
-    static uint32_t s_userCntGbl;  // Count of which usage of userp() this is
-    static bool s_userBusy;  // Count is in use
+    static thread_local uint32_t s_userCntGbl;  // Count of which usage of userp() this is
+    static thread_local bool s_userBusy;  // Count is in use
 public:
     VNUser4InUse()      { allocate(4, s_userCntGbl/*ref*/, s_userBusy/*ref*/); }
     ~VNUser4InUse()     { free    (4, s_userCntGbl/*ref*/, s_userBusy/*ref*/); }
@@ -2278,12 +2288,16 @@ public:
 
     // clang-format off
     VNUser user1u() const VL_MT_STABLE {
-        // Slows things down measurably, so disabled by default
-        //UASSERT_STATIC(VNUser1InUse::s_userBusy, "user1p used without AstUserInUse");
+        // Slows things down measurably, so only in debug builds. Epochs are per thread, so
+        // this also catches use on a thread other than the one holding the AstUserInUse.
+        UDEBUGONLY(UASSERT_STATIC(VNUser1InUse::s_userBusy, "user1p used without AstUserInUse"););
         return ((m_user1Cnt == VNUser1InUse::s_userCntGbl) ? m_user1u : VNUser{0});
     }
     AstNode* user1p() const VL_MT_STABLE { return user1u().toNodep(); }
-    void user1u(const VNUser& user) { m_user1u = user; m_user1Cnt = VNUser1InUse::s_userCntGbl; }
+    void user1u(const VNUser& user) {
+        UDEBUGONLY(UASSERT_STATIC(VNUser1InUse::s_userBusy, "user1p set without AstUserInUse"););
+        m_user1u = user; m_user1Cnt = VNUser1InUse::s_userCntGbl;
+    }
     void user1p(void* userp) { user1u(VNUser{userp}); }
     void user1(int val) { user1u(VNUser{val}); }
     int user1() const { return user1u().toInt(); }
@@ -2292,12 +2306,16 @@ public:
     static void user1ClearTree() { VNUser1InUse::clear(); }  // Clear userp()'s across the entire tree
 
     VNUser user2u() const VL_MT_STABLE {
-        // Slows things down measurably, so disabled by default
-        //UASSERT_STATIC(VNUser2InUse::s_userBusy, "user2p used without AstUserInUse");
+        // Slows things down measurably, so only in debug builds. Epochs are per thread, so
+        // this also catches use on a thread other than the one holding the AstUserInUse.
+        UDEBUGONLY(UASSERT_STATIC(VNUser2InUse::s_userBusy, "user2p used without AstUserInUse"););
         return ((m_user2Cnt == VNUser2InUse::s_userCntGbl) ? m_user2u : VNUser{0});
     }
     AstNode* user2p() const VL_MT_STABLE { return user2u().toNodep(); }
-    void user2u(const VNUser& user) { m_user2u = user; m_user2Cnt = VNUser2InUse::s_userCntGbl; }
+    void user2u(const VNUser& user) {
+        UDEBUGONLY(UASSERT_STATIC(VNUser2InUse::s_userBusy, "user2p set without AstUserInUse"););
+        m_user2u = user; m_user2Cnt = VNUser2InUse::s_userCntGbl;
+    }
     void user2p(void* userp) { user2u(VNUser{userp}); }
     void user2(int val) { user2u(VNUser{val}); }
     int user2() const { return user2u().toInt(); }
@@ -2306,12 +2324,16 @@ public:
     static void user2ClearTree() { VNUser2InUse::clear(); }  // Clear userp()'s across the entire tree
 
     VNUser user3u() const VL_MT_STABLE {
-        // Slows things down measurably, so disabled by default
-        //UASSERT_STATIC(VNUser3InUse::s_userBusy, "user3p used without AstUserInUse");
+        // Slows things down measurably, so only in debug builds. Epochs are per thread, so
+        // this also catches use on a thread other than the one holding the AstUserInUse.
+        UDEBUGONLY(UASSERT_STATIC(VNUser3InUse::s_userBusy, "user3p used without AstUserInUse"););
         return ((m_user3Cnt == VNUser3InUse::s_userCntGbl) ? m_user3u : VNUser{0});
     }
     AstNode* user3p() const VL_MT_STABLE { return user3u().toNodep(); }
-    void user3u(const VNUser& user) { m_user3u = user; m_user3Cnt = VNUser3InUse::s_userCntGbl; }
+    void user3u(const VNUser& user) {
+        UDEBUGONLY(UASSERT_STATIC(VNUser3InUse::s_userBusy, "user3p set without AstUserInUse"););
+        m_user3u = user; m_user3Cnt = VNUser3InUse::s_userCntGbl;
+    }
     void user3p(void* userp) { user3u(VNUser{userp}); }
     void user3(int val) { user3u(VNUser{val}); }
     int user3() const { return user3u().toInt(); }
@@ -2320,12 +2342,16 @@ public:
     static void user3ClearTree() { VNUser3InUse::clear(); }  // Clear userp()'s across the entire tree
 
     VNUser user4u() const VL_MT_STABLE {
-        // Slows things down measurably, so disabled by default
-        //UASSERT_STATIC(VNUser4InUse::s_userBusy, "user4p used without AstUserInUse");
+        // Slows things down measurably, so only in debug builds. Epochs are per thread, so
+        // this also catches use on a thread other than the one holding the AstUserInUse.
+        UDEBUGONLY(UASSERT_STATIC(VNUser4InUse::s_userBusy, "user4p used without AstUserInUse"););
         return ((m_user4Cnt == VNUser4InUse::s_userCntGbl) ? m_user4u : VNUser{0});
     }
     AstNode* user4p() const VL_MT_STABLE { return user4u().toNodep(); }
-    void user4u(const VNUser& user) { m_user4u = user; m_user4Cnt = VNUser4InUse::s_userCntGbl; }
+    void user4u(const VNUser& user) {
+        UDEBUGONLY(UASSERT_STATIC(VNUser4InUse::s_userBusy, "user4p set without AstUserInUse"););
+        m_user4u = user; m_user4Cnt = VNUser4InUse::s_userCntGbl;
+    }
     void user4p(void* userp) { user4u(VNUser{userp}); }
     void user4(int val) { user4u(VNUser{val}); }
     int user4() const { return user4u().toInt(); }
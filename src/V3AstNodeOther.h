@@ -3052,7 +3052,7 @@ public:
 };
 class AstCoverToggle final : public AstNodeStmt {
     // Toggle analysis of given signal
-    // Parents:  MODULE
+    // Parents:  MODULE, or AlwaysPostponed with --coverage-toggle-stride
     // @astgen op1 := incp : AstCoverInc
     // @astgen op2 := origp : AstNodeExpr
     // @astgen op3 := changep : AstNodeExpr
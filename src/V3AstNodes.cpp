@@ -1539,10 +1539,10 @@ void AstNode::dump(std::ostream& str) const {
 #endif
         << " {" << fileline()->filenameLetters() << std::dec << fileline()->lastLineno()
         << fileline()->firstColumnLetters() << "}";
-    if (user1p()) str << " u1=" << nodeAddr(user1p());
-    if (user2p()) str << " u2=" << nodeAddr(user2p());
-    if (user3p()) str << " u3=" << nodeAddr(user3p());
-    if (user4p()) str << " u4=" << nodeAddr(user4p());
+    if (VNUser1InUse::s_userBusy && user1p()) str << " u1=" << nodeAddr(user1p());
+    if (VNUser2InUse::s_userBusy && user2p()) str << " u2=" << nodeAddr(user2p());
+    if (VNUser3InUse::s_userBusy && user3p()) str << " u3=" << nodeAddr(user3p());
+    if (VNUser4InUse::s_userBusy && user4p()) str << " u4=" << nodeAddr(user4p());
     if (hasDType()) {
         // Final @ so less likely to by accident read it as a nodep
         if (dtypep() == this) {
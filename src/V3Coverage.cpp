@@ -144,6 +144,8 @@ class CoverageVisitor final : public VNVisitor {
     bool m_inToggleOff = false;  // In function/task etc
     bool m_inLoopNotBody = false;  // Inside a loop, but not in its body
     string m_beginHier;  // AstBegin hier name for user coverage points
+    AstNode* m_varTogglesp = nullptr;  // Sampled toggle coverage of current variable
+    AstNode* m_sampledTogglesp = nullptr;  // Sampled toggle coverage of current module
 
     // STATE - cleared each module
     std::unordered_map<std::string, uint32_t> m_varnames;  // Uniquify inserted variable names
@@ -276,7 +278,9 @@ class CoverageVisitor final : public VNVisitor {
         VL_RESTORER(m_modp);
         VL_RESTORER(m_state);
         createHandle(nodep);
+        VL_RESTORER(m_sampledTogglesp);
         m_modp = nodep;
+        m_sampledTogglesp = nullptr;
         m_state.m_inModOff
             = nodep->isTop();  // Ignore coverage on top module; it's a shell we created
         if (!origModp) {
@@ -285,6 +289,39 @@ class CoverageVisitor final : public VNVisitor {
             m_handleLines.clear();
         }
         iterateChildren(nodep);
+        if (m_sampledTogglesp) addSampledToggles(m_sampledTogglesp);
+    }
+
+    void addSampledToggles(AstNode* togglesp) {
+        // With --coverage-toggle-stride, rather than checking toggles
+        // whenever a signal changes, check them all once at the end of every
+        // stride'th eval, in the postponed region:
+        //    ++sample; if (sample == stride) { sample = 0; toggles... }
+        FileLine* const fl = togglesp->fileline();
+        const int stride = v3Global.opt.coverageToggleStride();
+        AstNode* stmtsp = togglesp;
+        if (stride > 1) {
+            FileLine* const fl_nowarn = new FileLine{fl};
+            fl_nowarn->modifyWarnOff(V3ErrorCode::UNUSEDSIGNAL, true);
+            AstVar* const varp = new AstVar{fl_nowarn, VVarType::MODULETEMP, "__Vtogcov_sample",
+                                            m_modp->findUInt32DType()};
+            m_modp->addStmtsp(varp);
+            AstNode* const resetp = new AstAssign{fl, new AstVarRef{fl, varp, VAccess::WRITE},
+                                                  new AstConst{fl, AstConst::WidthedValue{}, 32, 0}};
+            resetp->addNext(togglesp);
+            AstIf* const ifp = new AstIf{
+                fl,
+                new AstEq{fl, new AstVarRef{fl, varp, VAccess::READ},
+                          new AstConst{fl, AstConst::WidthedValue{}, 32,
+                                       static_cast<uint32_t>(stride)}},
+                resetp};
+            stmtsp = new AstAssign{
+                fl, new AstVarRef{fl, varp, VAccess::WRITE},
+                new AstAdd{fl, new AstVarRef{fl, varp, VAccess::READ},
+                           new AstConst{fl, AstConst::WidthedValue{}, 32, 1}}};
+            stmtsp->addNext(ifp);
+        }
+        m_modp->addStmtsp(new AstAlwaysPostponed{fl, stmtsp});
     }
 
     void visit(AstNodeProcedure* nodep) override { iterateProcedure(nodep); }
@@ -388,6 +425,19 @@ class CoverageVisitor final : public VNVisitor {
                                  new AstVarRef{fl_nowarn, chgVarp, VAccess::WRITE}};
                 toggleVarRecurse(nodep->dtypeSkipRefp(), 0, newvec, nodep);
                 newvec.cleanup();
+
+                if (AstNode* stmtsp = m_varTogglesp) {
+                    m_varTogglesp = nullptr;
+                    if (nodep->dtypep()->skipRefp()->isIntegralOrPacked()) {
+                        // Skip checking each bit when the whole signal is unchanged
+                        stmtsp = new AstIf{
+                            fl_nowarn,
+                            new AstNeq{fl_nowarn, new AstVarRef{fl_nowarn, nodep, VAccess::READ},
+                                       new AstVarRef{fl_nowarn, chgVarp, VAccess::READ}},
+                            stmtsp};
+                    }
+                    m_sampledTogglesp = AstNode::addNext(m_sampledTogglesp, stmtsp);
+                }
             }
         }
     }
@@ -400,7 +450,11 @@ class CoverageVisitor final : public VNVisitor {
             newCoverInc(varp->fileline(), "", "v_toggle",
                         hierPrefix + varp->name() + above.m_comment, "", 0, ""),
             above.m_varRefp->cloneTree(false), above.m_chgRefp->cloneTree(false)};
-        m_modp->addStmtsp(newp);
+        if (v3Global.opt.coverageToggleStride() && !VN_IS(m_modp, Class)) {
+            m_varTogglesp = AstNode::addNext(m_varTogglesp, newp);  // See addSampledToggles
+        } else {
+            m_modp->addStmtsp(newp);
+        }
     }
 
     void toggleVarRecurse(const AstNodeDType* const dtypep, const int depth,  // per-iteration
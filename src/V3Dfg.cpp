@@ -391,6 +391,72 @@ DfgVertex::DfgVertex(DfgGraph& dfg, VDfgType type, FileLine* flp, AstNodeDType*
 
 DfgVertex::~DfgVertex() {}
 
+// State of 'dtypeForWidth' while graphs are optimized concurrently
+static V3Mutex s_dtypeMutex;
+static bool s_dtypesConcurrent VL_GUARDED_BY(s_dtypeMutex) = false;
+// Canonical type of each width, while concurrent
+static std::unordered_map<uint32_t, AstNodeDType*> s_dtypeCache VL_GUARDED_BY(s_dtypeMutex);
+// Types created while concurrent, not yet in the type table, by width
+static std::map<uint32_t, AstBasicDType*> s_dtypesNew VL_GUARDED_BY(s_dtypeMutex);
+
+AstNodeDType* DfgVertex::dtypeForWidth(uint32_t width) VL_MT_SAFE {
+    AstTypeTable* const tablep = v3Global.rootp()->typeTablep();
+    const V3LockGuard lock{s_dtypeMutex};
+    if (!s_dtypesConcurrent) return tablep->findLogicDType(width, width, VSigning::UNSIGNED);
+    AstNodeDType*& dtypepr = s_dtypeCache[width];
+    if (!dtypepr) {
+        AstBasicDType* const newp = new AstBasicDType{tablep->fileline(), VBasicDTypeKwd::LOGIC,
+                                                      VSigning::UNSIGNED, width, width};
+        s_dtypesNew.emplace(width, newp);
+        dtypepr = newp;
+    }
+    return dtypepr;
+}
+
+void DfgVertex::dtypesConcurrentBegin(const std::vector<DfgGraph*>& dfgps) {
+    const V3LockGuard lock{s_dtypeMutex};
+    UASSERT_STATIC(!s_dtypesConcurrent, "Already concurrent");
+    s_dtypesConcurrent = true;
+    // The types used by the graphs are already in the type table, so are the ones to reuse
+    for (DfgGraph* const dfgp : dfgps) {
+        dfgp->forEachVertex([](const DfgVertex& vtx) {
+            AstNodeDType* dtypep = vtx.dtypep();
+            if (AstUnpackArrayDType* const typep = VN_CAST(dtypep, UnpackArrayDType)) {
+                dtypep = typep->subDTypep();
+            }
+            if (VN_IS(dtypep, BasicDType)) s_dtypeCache.emplace(dtypep->width(), dtypep);
+        });
+    }
+}
+
+void DfgVertex::dtypesConcurrentEnd(const std::vector<DfgGraph*>& dfgps) {
+    const V3LockGuard lock{s_dtypeMutex};
+    UASSERT_STATIC(s_dtypesConcurrent, "Not concurrent");
+    s_dtypesConcurrent = false;
+    s_dtypeCache.clear();
+    AstTypeTable* const tablep = v3Global.rootp()->typeTablep();
+    std::unordered_map<AstNodeDType*, AstNodeDType*> replacements;
+    for (const auto& pair : s_dtypesNew) {
+        AstBasicDType* const newp = pair.second;
+        AstBasicDType* const samep = tablep->findInsertSameDType(newp);
+        if (samep == newp) {
+            tablep->addTypesp(newp);
+        } else {
+            // Already in the type table, but not used by the graphs before
+            replacements.emplace(newp, samep);
+        }
+    }
+    s_dtypesNew.clear();
+    if (replacements.empty()) return;
+    for (DfgGraph* const dfgp : dfgps) {
+        dfgp->forEachVertex([&](DfgVertex& vtx) {
+            const auto it = replacements.find(vtx.dtypep());
+            if (it != replacements.end()) vtx.dtypep(it->second);
+        });
+    }
+    for (const auto& pair : replacements) pair.first->deleteTree();
+}
+
 bool DfgVertex::selfEquals(const DfgVertex& that) const { return true; }
 
 V3Hash DfgVertex::selfHash() const { return V3Hash{}; }
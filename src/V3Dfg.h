@@ -197,9 +197,14 @@ public:
     // Return data type used to represent any packed value of the given 'width'. All packed types
     // of a given width use the same canonical data type, as the only interesting information is
     // the total width.
-    static AstNodeDType* dtypeForWidth(uint32_t width) {
-        return v3Global.rootp()->typeTablep()->findLogicDType(width, width, VSigning::UNSIGNED);
-    }
+    // Can be called from multiple threads optimizing different graphs, between
+    // 'dtypesConcurrentBegin' and 'dtypesConcurrentEnd'.
+    static AstNodeDType* dtypeForWidth(uint32_t width) VL_MT_SAFE;
+    // While the given graphs are optimized concurrently, 'dtypeForWidth' does not change the
+    // type table, so the type table does not depend on the order the threads run in. Types it
+    // creates are added to the type table in order of width by 'dtypesConcurrentEnd'.
+    static void dtypesConcurrentBegin(const std::vector<DfgGraph*>& dfgps) VL_MT_DISABLED;
+    static void dtypesConcurrentEnd(const std::vector<DfgGraph*>& dfgps) VL_MT_DISABLED;
 
     // Return data type used to represent the type of 'nodep' when converted to a DfgVertex
     static AstNodeDType* dtypeFor(const AstNode* nodep) {
@@ -735,6 +740,16 @@ public:
     std::vector<std::unique_ptr<DfgGraph>>
     extractCyclicComponents(std::string label) VL_MT_DISABLED;
 
+    // Break all cycles in 'this' graph, so it can be optimized as a DAG. Each cycle is broken at
+    // a variable on the cycle, by moving all sinks of the variable vertex to a new, undriven
+    // vertex of the same variable. Returns the pairs of original and new vertices, which must be
+    // passed to 'restoreCycles' before converting the graph back to Ast.
+    std::vector<std::pair<DfgVertexVar*, DfgVertexVar*>> breakCycles() VL_MT_DISABLED;
+
+    // Undo 'breakCycles', moving the sinks of the new vertices back to the original vertices
+    void restoreCycles(const std::vector<std::pair<DfgVertexVar*, DfgVertexVar*>>& cuts)
+        VL_MT_DISABLED;
+
     // Dump graph in Graphviz format into the given stream 'os'. 'label' is added to the name of
     // the graph which is included in the output.
     void dumpDot(std::ostream& os, const string& label = "") const VL_MT_DISABLED;
@@ -25,6 +25,7 @@
 
 #include <deque>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -539,3 +540,118 @@ public:
 std::vector<std::unique_ptr<DfgGraph>> DfgGraph::extractCyclicComponents(std::string label) {
     return ExtractCyclicComponents::apply(*this, label);
 }
+
+class BreakCycles final {
+    static constexpr size_t DONE = std::numeric_limits<size_t>::max();
+
+    // STATE
+    DfgGraph& m_dfg;  // The input graph
+    std::vector<DfgVertex*> m_stack;  // Vertices on the current path of the traversal
+    std::vector<DfgVertexVar*> m_cutps;  // Variables to cut, found in the current traversal
+    std::unordered_set<const DfgVertexVar*> m_cutSet;  // Same as 'm_cutps', for lookup
+    std::vector<std::pair<DfgVertexVar*, DfgVertexVar*>> m_cuts;  // Original, new vertex
+
+    // METHODS
+
+    // Variables that can be inlined are better kept intact, as inlining enables optimizations
+    static bool isInlinable(const DfgVertexVar& vtx) {
+        const DfgVarPacked* const varp = vtx.cast<DfgVarPacked>();
+        return varp && varp->isDrivenFullyByDfg();
+    }
+
+    // Choose a variable to cut the cycle closed by an edge back to 'm_stack[begin]'
+    void cutCycle(size_t begin) {
+        DfgVertexVar* bestp = nullptr;
+        for (size_t i = m_stack.size(); i-- > begin;) {
+            DfgVertexVar* const varp = m_stack[i]->cast<DfgVertexVar>();
+            if (!varp) continue;
+            // Already broken by an earlier cut
+            if (m_cutSet.count(varp)) return;
+            // Prefer variables that cannot be inlined, then the one closest to the back edge
+            if (!bestp || (isInlinable(*bestp) && !isInlinable(*varp))) bestp = varp;
+        }
+        // As the input graph was converted from an AST, all cycles go through a variable
+        UASSERT_OBJ(bestp, m_stack[begin], "Cycle without a variable");
+        m_cutSet.insert(bestp);
+        m_cutps.push_back(bestp);
+    }
+
+    // Depth first traversal, DfgVertex::user<size_t>() is 0 if not yet visited, the index
+    // of the vertex in 'm_stack' plus 1 while on the current path, and DONE afterwards.
+    void visit(DfgVertex& vtx) {
+        vtx.user<size_t>() = m_stack.size() + 1;
+        m_stack.push_back(&vtx);
+        const DfgVertexVar* const varp = vtx.cast<DfgVertexVar>();
+        vtx.forEachSink([&](DfgVertex& sink) {
+            // The remaining sinks of a variable cut during this traversal will be unlinked
+            if (varp && m_cutSet.count(varp)) return;
+            const size_t state = sink.user<size_t>();
+            if (!state) {
+                visit(sink);
+            } else if (state != DONE) {
+                // Edge to a vertex on the current path, so it closes a cycle
+                cutCycle(state - 1);
+            }
+        });
+        m_stack.pop_back();
+        vtx.user<size_t>() = DONE;
+    }
+
+    bool findCuts() {
+        const auto userDataInUse = m_dfg.userDataInUse();
+        m_cutSet.clear();
+        // All cycles go through a variable, so we only start traversals through them
+        for (DfgVertexVar& vtx : m_dfg.varVertices()) {
+            if (!vtx.user<size_t>()) visit(vtx);
+        }
+        return !m_cutps.empty();
+    }
+
+    void cut(DfgVertexVar& vtx) {
+        DfgVertexVar* newp = nullptr;
+        if (DfgVarPacked* const pVtxp = vtx.cast<DfgVarPacked>()) {
+            if (AstVarScope* const vscp = pVtxp->varScopep()) {
+                newp = new DfgVarPacked{m_dfg, vscp};
+            } else {
+                newp = new DfgVarPacked{m_dfg, pVtxp->varp()};
+            }
+        } else if (DfgVarArray* const aVtxp = vtx.cast<DfgVarArray>()) {
+            if (AstVarScope* const vscp = aVtxp->varScopep()) {
+                newp = new DfgVarArray{m_dfg, vscp};
+            } else {
+                newp = new DfgVarArray{m_dfg, aVtxp->varp()};
+            }
+        }
+        UASSERT_OBJ(newp, &vtx, "Unhandled 'DfgVertexVar' sub-type");
+        vtx.forEachSinkEdge([&](DfgEdge& edge) { edge.relinkSource(newp); });
+        m_cuts.emplace_back(&vtx, newp);
+    }
+
+    // CONSTRUCTOR - entry point
+    explicit BreakCycles(DfgGraph& dfg)
+        : m_dfg{dfg} {
+        // A traversal of a cyclic graph always finds a cycle to cut, so repeat until it does
+        // not, as cuts made during a traversal might not break cycles found earlier in it.
+        while (findCuts()) {
+            for (DfgVertexVar* const vtxp : m_cutps) cut(*vtxp);
+            m_cutps.clear();
+        }
+    }
+
+public:
+    static std::vector<std::pair<DfgVertexVar*, DfgVertexVar*>> apply(DfgGraph& dfg) {
+        return std::move(BreakCycles{dfg}.m_cuts);
+    }
+};
+
+std::vector<std::pair<DfgVertexVar*, DfgVertexVar*>> DfgGraph::breakCycles() {
+    return BreakCycles::apply(*this);
+}
+
+void DfgGraph::restoreCycles(const std::vector<std::pair<DfgVertexVar*, DfgVertexVar*>>& cuts) {
+    for (const auto& pair : cuts) {
+        DfgVertexVar* const newp = pair.second;
+        newp->forEachSinkEdge([&](DfgEdge& edge) { edge.relinkSource(pair.first); });
+        VL_DO_DANGLING(newp->unlinkDelete(*this), newp);
+    }
+}
@@ -250,14 +250,11 @@ static void process(DfgGraph& dfg, V3DfgOptimizationContext& ctx) {
     // Quick sanity check
     UASSERT_OBJ(dfg.size() == 0, dfg.modulep(), "DfgGraph should have become empty");
 
-    // For each acyclic component
-    for (auto& component : acyclicComponents) {
-        if (dumpDfgLevel() >= 7) component->dumpDotFilePrefixed(ctx.prefix() + "source");
-        // Optimize the component
-        V3DfgPasses::optimize(*component, ctx);
-        // Add back under the main DFG (we will convert everything back in one go)
-        dfg.addGraph(*component);
-    }
+    // Optimize the acyclic components, these are independent, so can be done in parallel
+    V3DfgPasses::optimize(acyclicComponents, ctx);
+
+    // Add back under the main DFG (we will convert everything back in one go)
+    for (auto& component : acyclicComponents) dfg.addGraph(*component);
 
     // Eliminate redundant variables. Run this on the whole acyclic DFG. It needs to traverse
     // the module/netlist to perform variable substitutions. Doing this by component would do
@@ -267,8 +264,13 @@ static void process(DfgGraph& dfg, V3DfgOptimizationContext& ctx) {
     // For each cyclic component
     for (auto& component : cyclicComponents) {
         if (dumpDfgLevel() >= 7) component->dumpDotFilePrefixed(ctx.prefix() + "source");
-        // Converting back to Ast assumes the 'regularize' pass was run, so we must run it
-        V3DfgPasses::regularize(*component, ctx.m_regularizeContext);
+        if (v3Global.opt.fDfgBreakCycles()) {
+            // Optimize with the cycles temporarily broken, this also regularizes
+            V3DfgPasses::optimizeCyclic(*component, ctx);
+        } else {
+            // Converting back to Ast assumes the 'regularize' pass was run, so we must run it
+            V3DfgPasses::regularize(*component, ctx.m_regularizeContext);
+        }
         // Add back under the main DFG (we will convert everything back in one go)
         dfg.addGraph(*component);
     }
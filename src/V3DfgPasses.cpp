@@ -14,7 +14,7 @@
 //
 //*************************************************************************
 
-#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+#include "V3PchAstMT.h"
 
 #include "V3DfgPasses.h"
 
@@ -22,6 +22,7 @@
 #include "V3File.h"
 #include "V3Global.h"
 #include "V3String.h"
+#include "V3ThreadPool.h"
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -31,6 +32,10 @@ V3DfgBinToOneHotContext::~V3DfgBinToOneHotContext() {
 }
 
 V3DfgCseContext::~V3DfgCseContext() {
+    if (m_parentp) {
+        m_parentp->m_eliminated += m_eliminated;
+        return;
+    }
     V3Stats::addStat("Optimizations, DFG " + m_label + " CSE, expressions eliminated",
                      m_eliminated);
 }
@@ -76,6 +81,7 @@ V3DfgOptimizationContext::~V3DfgOptimizationContext() {
     V3Stats::addStat(prefix + "Ast2Dfg, non-representable (var ref)", m_nonRepVarRef);
     V3Stats::addStat(prefix + "Ast2Dfg, non-representable (width)", m_nonRepWidth);
     V3Stats::addStat(prefix + "Dfg2Ast, result equations", m_resultEquations);
+    V3Stats::addStat(prefix + "BreakCycles, variables cut", m_cyclesBroken);
 
     // Print the collected patterns
     if (v3Global.opt.stats()) {
@@ -592,12 +598,30 @@ void V3DfgPasses::eliminateVars(DfgGraph& dfg, V3DfgEliminateVarsContext& ctx) {
     for (AstNode* const nodep : replacedVariables) nodep->unlinkFrBack()->deleteTree();
 }
 
-void V3DfgPasses::optimize(DfgGraph& dfg, V3DfgOptimizationContext& ctx) {
-    // There is absolutely nothing useful we can do with a graph of size 2 or less
-    if (dfg.size() <= 2) return;
-
-    int passNumber = 0;
-
+// Contexts of the passes that only change the DfgGraph they are applied to. These passes can
+// be applied to different graphs concurrently, with a separate instance on each thread.
+struct DfgGraphPassContext final {
+    V3DfgCseContext m_cseContext0;
+    V3DfgCseContext m_cseContext1;
+    V3DfgPeepholeContext m_peepholeContext;
+    V3DfgPatternStats m_patternStats;
+    V3DfgPatternStats& m_parentPatternStats;
+
+    explicit DfgGraphPassContext(V3DfgOptimizationContext& ctx)
+        : m_cseContext0{ctx.m_cseContext0}
+        , m_cseContext1{ctx.m_cseContext1}
+        , m_peepholeContext{ctx.m_peepholeContext}
+        , m_parentPatternStats{ctx.m_patternStats} {}
+    ~DfgGraphPassContext() { m_parentPatternStats.accumulate(m_patternStats); }
+    VL_UNCOPYABLE(DfgGraphPassContext);
+};
+
+// The passes applied by 'optimize' are split into stages. Passes in odd stages create Ast
+// nodes, so these stages must be applied to one graph at a time.
+static constexpr unsigned OPTIMIZE_STAGES = 4;
+
+static void optimizeStage(DfgGraph& dfg, unsigned stage, V3DfgOptimizationContext& ctx,
+                          DfgGraphPassContext& gctx, int& passNumber) {
     const auto apply = [&](int dumpLevel, const string& name, std::function<void()> pass) {
         pass();
         if (dumpDfgLevel() >= dumpLevel) {
@@ -609,20 +633,114 @@ void V3DfgPasses::optimize(DfgGraph& dfg, V3DfgOptimizationContext& ctx) {
         ++passNumber;
     };
 
-    if (dumpDfgLevel() >= 8) dfg.dumpDotAllVarConesPrefixed(ctx.prefix() + "input");
-    apply(3, "input           ", [&]() {});
-    apply(4, "inlineVars      ", [&]() { inlineVars(dfg); });
-    apply(4, "cse0            ", [&]() { cse(dfg, ctx.m_cseContext0); });
-    if (dfg.modulep()) {
-        apply(4, "binToOneHot     ", [&]() { binToOneHot(dfg, ctx.m_binToOneHotContext); });
+    switch (stage) {
+    case 0:
+        if (dumpDfgLevel() >= 8) dfg.dumpDotAllVarConesPrefixed(ctx.prefix() + "input");
+        apply(3, "input           ", [&]() {});
+        apply(4, "inlineVars      ", [&]() { V3DfgPasses::inlineVars(dfg); });
+        apply(4, "cse0            ", [&]() { V3DfgPasses::cse(dfg, gctx.m_cseContext0); });
+        break;
+    case 1:
+        if (dfg.modulep()) {
+            apply(4, "binToOneHot     ", [&]() {  //
+                V3DfgPasses::binToOneHot(dfg, ctx.m_binToOneHotContext);
+            });
+        }
+        break;
+    case 2:
+        if (v3Global.opt.fDfgPeephole()) {
+            apply(4, "peephole        ", [&]() {  //
+                V3DfgPasses::peephole(dfg, gctx.m_peepholeContext);
+            });
+            // We just did CSE above, so without peephole there is no need to run it again these
+            apply(4, "cse1            ", [&]() { V3DfgPasses::cse(dfg, gctx.m_cseContext1); });
+        }
+        // Accumulate patterns for reporting
+        if (v3Global.opt.stats()) gctx.m_patternStats.accumulate(dfg);
+        break;
+    case 3:
+        apply(4, "regularize", [&]() { V3DfgPasses::regularize(dfg, ctx.m_regularizeContext); });
+        if (dumpDfgLevel() >= 8) dfg.dumpDotAllVarConesPrefixed(ctx.prefix() + "optimized");
+        break;
+    default: v3fatalSrc("Bad optimize stage " << stage);
+    }
+}
+
+void V3DfgPasses::optimize(DfgGraph& dfg, V3DfgOptimizationContext& ctx) {
+    // There is absolutely nothing useful we can do with a graph of size 2 or less
+    if (dfg.size() <= 2) return;
+
+    DfgGraphPassContext gctx{ctx};
+    int passNumber = 0;
+    for (unsigned stage = 0; stage < OPTIMIZE_STAGES; ++stage) {
+        optimizeStage(dfg, stage, ctx, gctx, passNumber);
+    }
+}
+
+void V3DfgPasses::optimizeCyclic(DfgGraph& dfg, V3DfgOptimizationContext& ctx) {
+    // Break the cycles, so the same passes as for acyclic graphs can be applied
+    const std::vector<std::pair<DfgVertexVar*, DfgVertexVar*>> cuts = dfg.breakCycles();
+    ctx.m_cyclesBroken += cuts.size();
+
+    DfgGraphPassContext gctx{ctx};
+    int passNumber = 0;
+    for (unsigned stage = 0; stage < OPTIMIZE_STAGES - 1; ++stage) {
+        optimizeStage(dfg, stage, ctx, gctx, passNumber);
+    }
+
+    // Restore the cycles, then regularize, which is required for converting back to Ast
+    dfg.restoreCycles(cuts);
+    optimizeStage(dfg, OPTIMIZE_STAGES - 1, ctx, gctx, passNumber);
+}
+
+void V3DfgPasses::optimize(const std::vector<std::unique_ptr<DfgGraph>>& dfgs,
+                           V3DfgOptimizationContext& ctx) {
+    const size_t nWorkers = std::min<size_t>(v3Global.opt.verilateJobs(), dfgs.size());
+
+    // Optimize one at a time if single threaded, or if dumping, as dumps are numbered by pass
+    if (nWorkers <= 1 || dumpDfgLevel() >= 3) {
+        for (const std::unique_ptr<DfgGraph>& dfgp : dfgs) {
+            if (dumpDfgLevel() >= 7) dfgp->dumpDotFilePrefixed(ctx.prefix() + "source");
+            optimize(*dfgp, ctx);
+        }
+        return;
     }
-    if (v3Global.opt.fDfgPeephole()) {
-        apply(4, "peephole        ", [&]() { peephole(dfg, ctx.m_peepholeContext); });
-        // We just did CSE above, so without peephole there is no need to run it again these
-        apply(4, "cse1            ", [&]() { cse(dfg, ctx.m_cseContext1); });
+
+    // There is absolutely nothing useful we can do with a graph of size 2 or less
+    std::vector<DfgGraph*> dfgps;
+    for (const std::unique_ptr<DfgGraph>& dfgp : dfgs) {
+        if (dfgp->size() > 2) dfgps.push_back(dfgp.get());
+    }
+
+    // Contexts of each worker, adding their stats to 'ctx' when destroyed
+    std::vector<std::unique_ptr<DfgGraphPassContext>> gctxps;
+    for (size_t i = 0; i < nWorkers; ++i) gctxps.emplace_back(new DfgGraphPassContext{ctx});
+
+    for (unsigned stage = 0; stage < OPTIMIZE_STAGES; ++stage) {
+        // Not dumping, so pass numbers are not used
+        int passNumber = 0;
+        if (stage % 2) {
+            // Creates Ast nodes, apply to each graph in order, so the result is deterministic
+            for (DfgGraph* const dfgp : dfgps) {
+                optimizeStage(*dfgp, stage, ctx, *gctxps.front(), passNumber);
+            }
+            continue;
+        }
+        // Graphs vary widely in size, so workers take the next graph when done with one
+        DfgVertex::dtypesConcurrentBegin(dfgps);
+        {
+            std::atomic<size_t> next{0};
+            V3ThreadScope threadScope;
+            for (const std::unique_ptr<DfgGraphPassContext>& gctxp : gctxps) {
+                DfgGraphPassContext* const workerCtxp = gctxp.get();
+                threadScope.enqueue([&dfgps, &next, &ctx, stage, workerCtxp]() {
+                    int workerPassNumber = 0;
+                    for (size_t i = next++; i < dfgps.size(); i = next++) {
+                        optimizeStage(*dfgps[i], stage, ctx, *workerCtxp, workerPassNumber);
+                    }
+                });
+            }
+        }
+        DfgVertex::dtypesConcurrentEnd(dfgps);
     }
-    // Accumulate patterns for reporting
-    if (v3Global.opt.stats()) ctx.m_patternStats.accumulate(dfg);
-    apply(4, "regularize", [&]() { regularize(dfg, ctx.m_regularizeContext); });
-    if (dumpDfgLevel() >= 8) dfg.dumpDotAllVarConesPrefixed(ctx.prefix() + "optimized");
 }
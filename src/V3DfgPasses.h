@@ -42,11 +42,16 @@ public:
 
 class V3DfgCseContext final {
     const std::string m_label;  // Label to apply to stats
+    V3DfgCseContext* const m_parentp = nullptr;  // Context to add stats to, instead of reporting
 
 public:
     VDouble0 m_eliminated;  // Number of common sub-expressions eliminated
     explicit V3DfgCseContext(const std::string& label)
         : m_label{label} {}
+    // Context for another thread, adds its stats to 'parent' when destroyed
+    explicit V3DfgCseContext(V3DfgCseContext& parent)
+        : m_label{parent.m_label}
+        , m_parentp{&parent} {}
     ~V3DfgCseContext() VL_MT_DISABLED;
 };
 
@@ -91,6 +96,7 @@ public:
     VDouble0 m_nonRepVarRef;  // Equations non-representable due to variable reference
     VDouble0 m_nonRepWidth;  // Equations non-representable due to width mismatch
     VDouble0 m_resultEquations;  // Number of result combinational equations
+    VDouble0 m_cyclesBroken;  // Number of variables cut to break cycles
 
     V3DfgBinToOneHotContext m_binToOneHotContext{m_label};
     V3DfgCseContext m_cseContext0{m_label + " 1st"};
@@ -123,6 +129,14 @@ DfgGraph* astToDfg(AstNetlist&, V3DfgOptimizationContext&) VL_MT_DISABLED;
 // Optimize the given DfgGraph
 void optimize(DfgGraph&, V3DfgOptimizationContext&) VL_MT_DISABLED;
 
+// Optimize the given cyclic DfgGraph, by optimizing it as a DAG with its cycles broken
+void optimizeCyclic(DfgGraph&, V3DfgOptimizationContext&) VL_MT_DISABLED;
+
+// Optimize the given independent DfgGraphs, concurrently on the V3ThreadPool when
+// --verilate-jobs allows. The result is the same as optimizing each in turn.
+void optimize(const std::vector<std::unique_ptr<DfgGraph>>&,
+              V3DfgOptimizationContext&) VL_MT_DISABLED;
+
 // Convert DfgGraph back into Ast, and insert converted graph back into the Ast.
 void dfgToAst(DfgGraph&, V3DfgOptimizationContext&) VL_MT_DISABLED;
 
@@ -132,6 +146,9 @@ void dfgToAst(DfgGraph&, V3DfgOptimizationContext&) VL_MT_DISABLED;
 
 // Construct binary to oneHot decoders
 void binToOneHot(DfgGraph&, V3DfgBinToOneHotContext&) VL_MT_DISABLED;
+// 'cse', 'inlineVars' and 'peephole' only change the given graph, so 'optimize' applies them
+// to distinct graphs concurrently. They use the rest of the (VL_MT_DISABLED) DFG library, so
+// are not thread safe otherwise.
 // Common subexpression elimination
 void cse(DfgGraph&, V3DfgCseContext&) VL_MT_DISABLED;
 // Inline fully driven variables
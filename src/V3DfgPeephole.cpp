@@ -48,7 +48,16 @@ V3DfgPeepholeContext::V3DfgPeepholeContext(const std::string& label)
 #undef OPTIMIZATION_CHECK_ENABLED
 }
 
+V3DfgPeepholeContext::V3DfgPeepholeContext(V3DfgPeepholeContext& parent)
+    : m_label{parent.m_label}
+    , m_parentp{&parent}
+    , m_enabled(parent.m_enabled) {}
+
 V3DfgPeepholeContext::~V3DfgPeepholeContext() {
+    if (m_parentp) {
+        for (size_t i = 0; i < m_count.size(); ++i) m_parentp->m_count[i] += m_count[i];
+        return;
+    }
     const auto emitStat = [this](VDfgPeepholePattern id) {
         string str{id.ascii()};
         std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) {  //
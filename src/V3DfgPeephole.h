@@ -122,6 +122,7 @@ public:
 
 struct V3DfgPeepholeContext final {
     const std::string m_label;  // Label to apply to stats
+    V3DfgPeepholeContext* const m_parentp = nullptr;  // Context to add stats to, if any
 
     // Enable flags for each optimization
     std::array<bool, VDfgPeepholePattern::_ENUM_END> m_enabled;
@@ -129,6 +130,8 @@ struct V3DfgPeepholeContext final {
     std::array<VDouble0, VDfgPeepholePattern::_ENUM_END> m_count;
 
     explicit V3DfgPeepholeContext(const std::string& label) VL_MT_DISABLED;
+    // Context for another thread, adds its stats to 'parent' when destroyed
+    explicit V3DfgPeepholeContext(V3DfgPeepholeContext& parent) VL_MT_DISABLED;
     ~V3DfgPeepholeContext() VL_MT_DISABLED;
 };
 
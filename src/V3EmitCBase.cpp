@@ -23,10 +23,12 @@
 //######################################################################
 // EmitCParentModule implementation
 
+std::unordered_map<const AstNode*, const AstNodeModule*> EmitCParentModule::s_parents;
+
 EmitCParentModule::EmitCParentModule() {
     const auto setAll = [](AstNodeModule* modp) -> void {
         for (AstNode* nodep = modp->stmtsp(); nodep; nodep = nodep->nextp()) {
-            if (VN_IS(nodep, CFunc) || VN_IS(nodep, Var)) nodep->user4p(modp);
+            if (VN_IS(nodep, CFunc) || VN_IS(nodep, Var)) s_parents.emplace(nodep, modp);
         }
     };
     for (AstNode* modp = v3Global.rootp()->modulesp(); modp; modp = modp->nextp()) {
@@ -35,6 +37,8 @@ EmitCParentModule::EmitCParentModule() {
     setAll(v3Global.rootp()->constPoolp()->modp());
 }
 
+EmitCParentModule::~EmitCParentModule() { s_parents.clear(); }
+
 //######################################################################
 // EmitCBase implementation
 
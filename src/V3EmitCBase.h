@@ -25,22 +25,25 @@
 
 #include <cmath>
 #include <cstdarg>
+#include <unordered_map>
 
 //######################################################################
-// Set user4p in all CFunc and Var to point to the containing AstNodeModule
+// Map all CFunc and Var to the containing AstNodeModule
 
 class EmitCParentModule final {
-    // NODE STATE
-    //   AstFunc::user4p()      AstNodeModule* Parent module pointer
-    //   AstVar::user4p()       AstNodeModule* Parent module pointer
-    const VNUser4InUse user4InUse;
+    // STATE
+    // Parent module of each CFunc and Var. Read by V3ThreadScope workers, so not kept in
+    // user*(), as those are per thread.
+    static std::unordered_map<const AstNode*, const AstNodeModule*> s_parents;
 
 public:
     EmitCParentModule();
+    ~EmitCParentModule();
     VL_UNCOPYABLE(EmitCParentModule);
 
     static const AstNodeModule* get(const AstNode* nodep) VL_MT_STABLE {
-        return VN_AS(nodep->user4p(), NodeModule);
+        const auto it = s_parents.find(nodep);
+        return it == s_parents.end() ? nullptr : it->second;
     }
 };
 
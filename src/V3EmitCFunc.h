@@ -640,9 +640,15 @@ public:
     }
     void visit(AstCoverDecl* nodep) override {
         putns(nodep, "vlSelf->__vlCoverInsert(");  // As Declared in emitCoverageDecl
-        puts("&(vlSymsp->__Vcoverage[");
-        puts(cvtToStr(nodep->dataDeclThisp()->binNum()));
-        puts("])");
+        if (v3Global.opt.coveragePerThread()) {
+            puts("vlSymsp->__Vcoverage.basep(");
+            puts(cvtToStr(nodep->dataDeclThisp()->binNum()));
+            puts(")");
+        } else {
+            puts("&(vlSymsp->__Vcoverage[");
+            puts(cvtToStr(nodep->dataDeclThisp()->binNum()));
+            puts("])");
+        }
         // If this isn't the first instantiation of this module under this
         // design, don't really count the bucket, and rely on verilator_cov to
         // aggregate counts.  This is because Verilator combines all
@@ -667,7 +673,7 @@ public:
         puts(");\n");
     }
     void visit(AstCoverInc* nodep) override {
-        if (v3Global.opt.threads() > 1) {
+        if (v3Global.opt.threads() > 1 && !v3Global.opt.coveragePerThread()) {
             putns(nodep, "vlSymsp->__Vcoverage[");
             puts(cvtToStr(nodep->declp()->dataDeclThisp()->binNum()));
             puts("].fetch_add(1, std::memory_order_relaxed);\n");
@@ -313,12 +313,13 @@ class EmitCImp final : EmitCFunc {
             // function. This gets around gcc slowness constructing all of the template
             // arguments.
             puts("void " + prefixNameProtect(m_modp) + "::__vlCoverInsert(");
-            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+            const bool atomic = v3Global.opt.threads() > 1 && !v3Global.opt.coveragePerThread();
+            puts(atomic ? "std::atomic<uint32_t>" : "uint32_t");
             puts("* countp, bool enable, const char* filenamep, int lineno, int column,\n");
             puts("const char* hierp, const char* pagep, const char* commentp, const char* "
                  "linescovp) "
                  "{\n");
-            if (v3Global.opt.threads() > 1) {
+            if (atomic) {
                 puts("assert(sizeof(uint32_t) == sizeof(std::atomic<uint32_t>));\n");
                 puts("uint32_t* count32p = reinterpret_cast<uint32_t*>(countp);\n");
             } else {
@@ -331,8 +332,16 @@ class EmitCImp final : EmitCFunc {
             // Used for second++ instantiation of identical bin
             puts("if (!enable) count32p = &fake_zero_count;\n");
             puts("*count32p = 0;\n");
-            puts("VL_COVER_INSERT(vlSymsp->_vm_contextp__->coveragep(), VerilatedModule::name(), "
-                 "count32p,");
+            if (v3Global.opt.coveragePerThread()) {
+                // Sum the counters of each thread's shard
+                puts("VL_COVER_INSERT_SHARDS(vlSymsp->_vm_contextp__->coveragep(), "
+                     "VerilatedModule::name(), count32p,");
+                puts(" enable ? vlSymsp->__Vcoverage.shards() : 1,");
+                puts(" vlSymsp->__Vcoverage.stride(),\n");
+            } else {
+                puts("VL_COVER_INSERT(vlSymsp->_vm_contextp__->coveragep(), "
+                     "VerilatedModule::name(), count32p,");
+            }
             puts("  \"filename\",filenamep,");
             puts("  \"lineno\",lineno,");
             puts("  \"column\",column,\n");
@@ -351,6 +360,19 @@ class EmitCImp final : EmitCFunc {
         puts("}\n");
         splitSizeInc(10);
     }
+    static bool isBulkSavable(const AstVar* varp) {
+        // Return true if variable is an unpacked array or wide packed
+        // value, made only of integral words, so may be saved as raw memory
+        const AstNodeDType* elementp = varp->dtypeSkipRefp();
+        bool array = elementp->isWide();
+        while (const AstUnpackArrayDType* const arrayp = VN_CAST(elementp, UnpackArrayDType)) {
+            array = true;
+            elementp = arrayp->subDTypep()->skipRefp();
+        }
+        const AstBasicDType* const basicp = elementp->basicp();
+        return array && basicp && !basicp->keyword().isMTaskState()
+               && elementp->isIntegralOrPacked() && !basicp->isOpaque();
+    }
     void emitSavableImp(const AstNodeModule* modp) {
         if (v3Global.opt.savable()) {
             puts("\n// Savable\n");
@@ -395,6 +417,12 @@ class EmitCImp final : EmitCFunc {
                         } else if (varp->isStatic() && varp->isConst()) {
                         } else if (varp->basicp() && varp->basicp()->isTriggerVec()) {
                         } else if (VN_IS(varp->dtypep(), NBACommitQueueDType)) {
+                        } else if (isBulkSavable(varp)) {
+                            // Arrays of integral data are contiguous in memory, and
+                            // write the same bytes as element by element would
+                            putns(varp, "os." + string{de ? "read" : "write"} + "(&"
+                                            + varp->nameProtect() + ", sizeof("
+                                            + varp->nameProtect() + "));\n");
                         } else {
                             int vects = 0;
                             AstNodeDType* elementp = varp->dtypeSkipRefp();
@@ -59,6 +59,7 @@ private:
         puts("\n");
 
         puts("#include \"verilated.h\"\n");
+        if (v3Global.usesTiming()) puts("#include \"verilated_timing.h\"\n");
         puts("#include \"" + topClassName() + ".h\"\n");
 
         puts("\n//======================\n\n");
@@ -110,6 +111,7 @@ private:
 
         puts("// Print statistical summary report\n");
         puts("contextp->statsPrintSummary();\n");
+        if (v3Global.usesTiming()) puts("VlCoroutineFramePool::statsPrint(contextp.get());\n");
         puts("\n");
 
         puts("return 0;\n");
@@ -254,10 +254,10 @@ class EmitCModel final : public EmitCFunc {
         puts("unsigned threads() const override final;\n");
         puts("/// Prepare for cloning the model at the process level (e.g. fork in Linux)\n");
         puts("/// Release necessary resources. Called before cloning.\n");
-        puts("void prepareClone() const;\n");
+        puts("void prepareClone() const override final;\n");
         puts("/// Re-init after cloning the model at the process level (e.g. fork in Linux)\n");
         puts("/// Re-allocate necessary resources. Called after cloning.\n");
-        puts("void atClone() const;\n");
+        puts("void atClone() const override final;\n");
         if (v3Global.opt.trace()) {
             puts("std::unique_ptr<VerilatedTraceConfig> traceConfig() const override final;\n");
         }
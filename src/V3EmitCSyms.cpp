@@ -488,6 +488,11 @@ void EmitCSyms::emitSymHdr() {
         puts("bool __Vm_even_cycle__ico = false;\n");
         puts("bool __Vm_even_cycle__act = false;\n");
         puts("bool __Vm_even_cycle__nba = false;\n");
+        if (v3Global.opt.threadsAlternatives() > 1) {
+            puts("VlThreadScheduleSelector __Vm_scheduleSelector__ico;\n");
+            puts("VlThreadScheduleSelector __Vm_scheduleSelector__act;\n");
+            puts("VlThreadScheduleSelector __Vm_scheduleSelector__nba;\n");
+        }
     }
 
     if (v3Global.opt.profExec()) {
@@ -505,12 +510,17 @@ void EmitCSyms::emitSymHdr() {
         putns(scopep, protectIf(scopep->nameDotless(), scopep->protect()) + ";\n");
     }
 
-    if (m_coverBins) {
+    // With per-thread counters, __vlCoverInsert always refers to the shards
+    if (m_coverBins || v3Global.opt.coveragePerThread()) {
         puts("\n// COVERAGE\n");
-        puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
-        puts(" __Vcoverage[");
-        puts(cvtToStr(m_coverBins));
-        puts("];\n");
+        if (v3Global.opt.coveragePerThread()) {
+            puts("VlCoverageShards __Vcoverage;\n");
+        } else {
+            puts(v3Global.opt.threads() > 1 ? "std::atomic<uint32_t>" : "uint32_t");
+            puts(" __Vcoverage[");
+            puts(cvtToStr(m_coverBins));
+            puts("];\n");
+        }
     }
 
     if (v3Global.opt.profPgo()) {
@@ -823,6 +833,9 @@ void EmitCSyms::emitSymImp() {
         puts("}\n");
         ++m_numStmts;
     }
+    if (v3Global.opt.coveragePerThread()) {
+        puts("    , __Vcoverage{" + cvtToStr(m_coverBins) + ", __Vm_threadPoolp}\n");
+    }
     puts("{\n");
 
     {
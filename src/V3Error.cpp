@@ -20,6 +20,7 @@
 #ifndef V3ERROR_NO_GLOBAL_
 # include "V3Ast.h"
 # include "V3DiagSarif.h"
+# include "V3File.h"
 # include "V3Global.h"
 # include "V3Stats.h"
 VL_DEFINE_DEBUG_FUNCTIONS;
@@ -93,6 +94,10 @@ string V3ErrorGuarded::msgPrefix() VL_REQUIRES(m_mutex) {
 }
 
 void V3ErrorGuarded::vlAbortOrExit() VL_REQUIRES(m_mutex) {
+#ifndef V3ERROR_NO_GLOBAL_
+    // Don't leave partially written --output-changed-only temporaries behind
+    V3File::removeTmpFiles();
+#endif
     if (V3Error::debugDefault()) {
         std::cerr << msgPrefix() << "Aborting since under --debug" << endl;
         V3Error::vlAbort();
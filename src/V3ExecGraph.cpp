@@ -65,6 +65,7 @@ class ThreadSchedule final {
 
     uint32_t m_id;  // Unique ID of a schedule
     static uint32_t s_nextId;  // Next ID number to use
+    uint32_t m_alternative = 0;  // Index of --threads-alternatives schedule, 0 if primary
     std::unordered_set<const ExecMTask*> mtasks;  // Mtasks in this schedule
     uint32_t m_endTime = 0;  // Latest task end time in this schedule
 
@@ -291,6 +292,13 @@ public:
     }
 
     uint32_t id() const { return m_id; }
+    uint32_t alternative() const { return m_alternative; }
+    // Name of the state variable of an mtask waiting for other threads in this schedule
+    string mtaskStateName(const ExecMTask* mtaskp) const {
+        string name = "__Vm_mtaskstate_" + cvtToStr(mtaskp->id());
+        if (m_alternative) name += "__a" + cvtToStr(m_alternative);
+        return name;
+    }
     uint32_t scheduleOn(const ExecMTask* mtaskp, uint32_t bestThreadId) {
         mtasks.emplace(mtaskp);
         const uint32_t bestEndTime = mtaskp->predictStart() + mtaskp->cost();
@@ -314,6 +322,30 @@ uint32_t ThreadSchedule::s_nextId = 0;
 std::unordered_map<const ExecMTask*, ThreadSchedule::MTaskState> ThreadSchedule::mtaskState{};
 constexpr double V3ExecGraph::ThreadSchedule::s_threadBoxWidth;
 
+// Set the priority of each mtask to the cost of the critical path from the start of the
+// mtask to the end of the graph.
+void computePriorities(V3Graph* execMTaskGraphp) {
+    for (V3GraphVertex& vtx : execMTaskGraphp->vertices()) {
+        ExecMTask* const mtp = vtx.as<ExecMTask>();
+        mtp->priority(mtp->cost());
+    }
+    GraphStreamUnordered ser(execMTaskGraphp, GraphWay::REVERSE);
+    while (const V3GraphVertex* const vxp = ser.nextp()) {
+        ExecMTask* const mtp = const_cast<V3GraphVertex*>(vxp)->as<ExecMTask>();
+        // "Priority" is the critical path from the start of the mtask, to
+        // the end of the graph reachable from this mtask.  Given the
+        // choice among several ready mtasks, we'll want to start the
+        // highest priority one first, so we're always working on the "long
+        // pole"
+        for (V3GraphEdge& edge : mtp->outEdges()) {
+            const ExecMTask* const followp = edge.top()->as<ExecMTask>();
+            if ((followp->priority() + mtp->cost()) > mtp->priority()) {
+                mtp->priority(followp->priority() + mtp->cost());
+            }
+        }
+    }
+}
+
 //######################################################################
 // PackThreads
 
@@ -732,6 +764,34 @@ public:
     static std::vector<ThreadSchedule> apply(V3Graph& mtaskGraph) {
         return PackThreads{}.pack(mtaskGraph);
     }
+
+    // Pack an alternative schedule for --threads-alternatives. The cost of each mtask is
+    // scaled by a deterministic pseudo-random factor between 1/2 and 2, so alternatives
+    // favor different mtasks. Leaves the costs and priorities of the mtasks unchanged, but
+    // the thread assignment in ThreadSchedule::mtaskState is the alternative's.
+    static ThreadSchedule applyAlternative(V3Graph& mtaskGraph, uint32_t alternative) {
+        std::unordered_map<ExecMTask*, uint32_t> origCosts;
+        for (V3GraphVertex& vtx : mtaskGraph.vertices()) {
+            ExecMTask* const mtaskp = vtx.as<ExecMTask>();
+            origCosts.emplace(mtaskp, mtaskp->cost());
+            uint64_t hash = (static_cast<uint64_t>(alternative) << 32 | mtaskp->id())
+                            * 0x9e3779b97f4a7c15ULL;
+            hash ^= hash >> 29;
+            const uint64_t scaled = static_cast<uint64_t>(mtaskp->cost()) * (16 + hash % 49) / 32;
+            mtaskp->cost(mtaskp->cost() ? static_cast<uint32_t>(std::max<uint64_t>(scaled, 1))
+                                        : 0);
+            ThreadSchedule::mtaskState.erase(mtaskp);
+        }
+        computePriorities(&mtaskGraph);
+
+        std::vector<ThreadSchedule> packed = PackThreads{}.pack(mtaskGraph);
+        UASSERT(packed.size() == 1, "Alternative schedules should not have wide tasks");
+        packed.front().m_alternative = alternative;
+
+        for (const auto& pair : origCosts) pair.first->cost(pair.second);
+        computePriorities(&mtaskGraph);
+        return std::move(packed.front());
+    }
 };
 
 using EstimateAndProfiled = std::pair<uint64_t, uint64_t>;  // cost est, cost profiled
@@ -841,21 +901,7 @@ void fillinCosts(V3Graph* execMTaskGraphp) {
 }
 
 void finalizeCosts(V3Graph* execMTaskGraphp) {
-    GraphStreamUnordered ser(execMTaskGraphp, GraphWay::REVERSE);
-    while (const V3GraphVertex* const vxp = ser.nextp()) {
-        ExecMTask* const mtp = const_cast<V3GraphVertex*>(vxp)->as<ExecMTask>();
-        // "Priority" is the critical path from the start of the mtask, to
-        // the end of the graph reachable from this mtask.  Given the
-        // choice among several ready mtasks, we'll want to start the
-        // highest priority one first, so we're always working on the "long
-        // pole"
-        for (V3GraphEdge& edge : mtp->outEdges()) {
-            const ExecMTask* const followp = edge.top()->as<ExecMTask>();
-            if ((followp->priority() + mtp->cost()) > mtp->priority()) {
-                mtp->priority(followp->priority() + mtp->cost());
-            }
-        }
-    }
+    computePriorities(execMTaskGraphp);
 
     // Some MTasks may now have zero cost, eliminate those.
     // (It's common for tasks to shrink to nothing when V3LifePost
@@ -906,7 +952,7 @@ void finalizeCosts(V3Graph* execMTaskGraphp) {
 }
 
 void addMTaskToFunction(const ThreadSchedule& schedule, const uint32_t threadId, AstCFunc* funcp,
-                        const ExecMTask* mtaskp) {
+                        const ExecMTask* mtaskp, const string& tag) {
     AstNodeModule* const modp = v3Global.rootp()->topModulep();
     FileLine* const fl = modp->fileline();
 
@@ -918,7 +964,7 @@ void addMTaskToFunction(const ThreadSchedule& schedule, const uint32_t threadId,
     if (const uint32_t nDependencies = schedule.crossThreadDependencies(mtaskp)) {
         // This mtask has dependencies executed on another thread, so it may block. Create the task
         // state variable and wait to be notified.
-        const string name = "__Vm_mtaskstate_" + cvtToStr(mtaskp->id());
+        const string name = schedule.mtaskStateName(mtaskp);
         AstBasicDType* const mtaskStateDtypep
             = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
         AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, name, mtaskStateDtypep};
@@ -941,8 +987,26 @@ void addMTaskToFunction(const ThreadSchedule& schedule, const uint32_t threadId,
                    + ");\n");
     }
 
-    // Move the actual body into this function
-    funcp->addStmtsp(mtaskp->bodyp()->unlinkFrBack());
+    // Measure the cost for selecting among alternative schedules
+    const string selector = "vlSymsp->__Vm_scheduleSelector__" + tag;
+    const bool alternatives = v3Global.opt.threadsAlternatives() > 1;
+    if (alternatives) {
+        addStrStmt("if (VL_UNLIKELY(" + selector + ".measuring())) " + selector
+                   + ".startCounter(" + std::to_string(mtaskp->id()) + ");\n");
+    }
+
+    if (schedule.alternative()) {
+        // The body was wrapped into a function, so call it again from the alternative
+        funcp->addStmtsp(mtaskp->bodyp()->stmtsp()->cloneTree(true));
+    } else {
+        // Move the actual body into this function
+        funcp->addStmtsp(mtaskp->bodyp()->unlinkFrBack());
+    }
+
+    if (alternatives) {
+        addStrStmt("if (VL_UNLIKELY(" + selector + ".measuring())) " + selector
+                   + ".stopCounter(" + std::to_string(mtaskp->id()) + ");\n");
+    }
 
     if (v3Global.opt.profPgo()) {
         // No lock around stopCounter, as counter numbers are unique per thread
@@ -954,7 +1018,7 @@ void addMTaskToFunction(const ThreadSchedule& schedule, const uint32_t threadId,
     for (const V3GraphEdge& edge : mtaskp->outEdges()) {
         const ExecMTask* const nextp = edge.top()->as<ExecMTask>();
         if (schedule.threadId(nextp) != threadId && schedule.contains(nextp)) {
-            addStrStmt("vlSelf->__Vm_mtaskstate_" + cvtToStr(nextp->id())
+            addStrStmt("vlSelf->" + schedule.mtaskStateName(nextp)
                        + ".signalUpstreamDone(even_cycle);\n");
         }
     }
@@ -987,7 +1051,7 @@ const std::vector<AstCFunc*> createThreadFunctions(const ThreadSchedule& schedul
 
         // Invoke each mtask scheduled to this thread from the thread function
         for (const ExecMTask* const mtaskp : thread) {
-            addMTaskToFunction(schedule, threadId, funcp, mtaskp);
+            addMTaskToFunction(schedule, threadId, funcp, mtaskp, tag);
         }
 
         // Unblock the fake "final" mtask when this thread is finished
@@ -1041,8 +1105,10 @@ void addThreadEndWrapper(AstExecGraph* const execGraphp) {
         addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).execGraphEnd();\n");
     }
 }
+// 'evenCycle' is the expression of the even/odd cycle flag the schedule runs on
 void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
-                               const std::vector<AstCFunc*>& funcps, uint32_t scheduleId) {
+                               const std::vector<AstCFunc*>& funcps, uint32_t scheduleId,
+                               const string& evenCycle) {
     // FileLine used for constructing nodes below
     FileLine* const fl = v3Global.rootp()->fileline();
     const string& tag = execGraphp->name();
@@ -1072,12 +1138,12 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
                 addTextStmt("vlSymsp->__Vm_threadPoolp->workerp(" + cvtToStr(i) + ")->addTask(");
             }
             execGraphp->addStmtsp(new AstAddrOfCFunc{fl, funcp});
-            addTextStmt(", vlSelf, vlSymsp->__Vm_even_cycle__" + tag + ");\n");
+            addTextStmt(", vlSelf, " + evenCycle + ");\n");
         } else {
             // The last will run on the main thread.
             AstCCall* const callp = new AstCCall{fl, funcp};
             callp->dtypeSetVoid();
-            callp->argTypes("vlSelf, vlSymsp->__Vm_even_cycle__" + tag);
+            callp->argTypes("vlSelf, " + evenCycle);
             execGraphp->addStmtsp(callp->makeStmt());
         }
         ++i;
@@ -1088,7 +1154,7 @@ void addThreadStartToExecGraph(AstExecGraph* const execGraphp,
         addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin();\n");
     }
     addStrStmt("vlSelf->__Vm_mtaskstate_final__" + std::to_string(scheduleId) + tag
-               + ".waitUntilUpstreamDone(vlSymsp->__Vm_even_cycle__" + tag + ");\n");
+               + ".waitUntilUpstreamDone(" + evenCycle + ");\n");
     if (v3Global.opt.profExec()) {
         addStrStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitEnd();\n");
     }
@@ -1161,7 +1227,223 @@ void implementExecGraph(AstExecGraph* const execGraphp, const ThreadSchedule& sc
     UASSERT(!funcps.empty(), "Non-empty ExecGraph yields no threads?");
 
     // Start the thread functions at the point this AstExecGraph is located in the tree.
-    addThreadStartToExecGraph(execGraphp, funcps, schedule.id());
+    addThreadStartToExecGraph(execGraphp, funcps, schedule.id(),
+                              "vlSymsp->__Vm_even_cycle__" + execGraphp->name());
+}
+
+// An alternative schedule, with the thread assignment that was packed for it
+struct AlternativeSchedule final {
+    ThreadSchedule schedule;
+    std::unordered_map<const ExecMTask*, ThreadSchedule::MTaskState> mtaskState;
+};
+
+void implementExecGraphAlternatives(AstExecGraph* const execGraphp,
+                                    const ThreadSchedule& schedule,
+                                    std::vector<AlternativeSchedule>& alternatives) {
+    // Nothing to be done if there are no MTasks in the graph at all.
+    if (execGraphp->depGraphp()->empty()) return;
+
+    FileLine* const fl = v3Global.rootp()->fileline();
+    const string& tag = execGraphp->name();
+    const string selector = "vlSymsp->__Vm_scheduleSelector__" + tag;
+
+    // Tables describing the graph and the schedules, see VlThreadScheduleSelector::configure
+    uint32_t nMTaskIds = 0;
+    for (const V3GraphVertex& vtx : execGraphp->depGraphp()->vertices()) {
+        nMTaskIds = std::max(nMTaskIds, vtx.as<const ExecMTask>()->id() + 1);
+    }
+    std::vector<uint32_t> preds;
+    for (const V3GraphVertex& vtx : execGraphp->depGraphp()->vertices()) {
+        if (vtx.inEmpty()) continue;
+        preds.push_back(vtx.as<const ExecMTask>()->id());
+        const size_t countIndex = preds.size();
+        preds.push_back(0);
+        for (const V3GraphEdge& edge : vtx.inEdges()) {
+            preds.push_back(edge.fromp()->as<const ExecMTask>()->id());
+            ++preds[countIndex];
+        }
+    }
+    preds.push_back(nMTaskIds);
+    std::vector<uint32_t> sequences;
+    const auto addSequences = [&](const ThreadSchedule& sched) {
+        sequences.push_back(sched.threads.size());
+        for (const std::vector<const ExecMTask*>& thread : sched.threads) {
+            sequences.push_back(thread.size());
+            for (const ExecMTask* const mtaskp : thread) sequences.push_back(mtaskp->id());
+        }
+    };
+    addSequences(schedule);
+    for (const AlternativeSchedule& alt : alternatives) addSequences(alt.schedule);
+    const auto tableText = [](const string& name, const std::vector<uint32_t>& values) {
+        string text = "static const uint32_t " + name + "[] = {";
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (i % 16 == 0) text += "\n    ";
+            text += cvtToStr(values[i]) + ",";
+        }
+        return text + "};\n";
+    };
+    execGraphp->addStmtsp(new AstCStmt{
+        fl, "if (VL_UNLIKELY(!" + selector + ".configured())) {\n"  //
+                + tableText("preds", preds) + tableText("sequences", sequences)  //
+                + selector + ".configure(vlSymsp->_vm_contextp__->threadsWarmup(), "
+                + cvtToStr(nMTaskIds) + ", preds, " + cvtToStr(alternatives.size() + 1)
+                + ", sequences);\n}\n"});
+
+    // Create the thread functions of a schedule, and return the statements starting them
+    const auto createSchedule = [&](const ThreadSchedule& sched) -> AstNode* {
+        const std::vector<AstCFunc*>& funcps = createThreadFunctions(sched, tag);
+        UASSERT(!funcps.empty(), "Non-empty ExecGraph yields no threads?");
+        AstNode* const prevStmtsp = execGraphp->stmtsp()->unlinkFrBackWithNext();
+        // Each schedule has its own mtask states, so alternates its own cycle flag
+        execGraphp->addStmtsp(new AstCStmt{fl, "const bool __Veven_cycle = " + selector
+                                                   + ".toggleEvenCycle("
+                                                   + cvtToStr(sched.alternative()) + ");\n"});
+        addThreadStartToExecGraph(execGraphp, funcps, sched.id(), "__Veven_cycle");
+        AstNode* const stmtsp = execGraphp->stmtsp()->unlinkFrBackWithNext();
+        execGraphp->addStmtsp(prevStmtsp);
+        return stmtsp;
+    };
+
+    // Start the selected schedule
+    AstNode* launchp = createSchedule(schedule);
+    for (auto it = alternatives.rbegin(); it != alternatives.rend(); ++it) {
+        // Thread assignment of the alternative is needed while creating its functions
+        std::swap(ThreadSchedule::mtaskState, it->mtaskState);
+        AstNode* const stmtsp = createSchedule(it->schedule);
+        std::swap(ThreadSchedule::mtaskState, it->mtaskState);
+        AstNodeExpr* const condp = new AstCExpr{
+            fl, selector + ".selected() == " + cvtToStr(it->schedule.alternative()), 1};
+        launchp = new AstIf{fl, condp, stmtsp, launchp};
+    }
+    execGraphp->addStmtsp(launchp);
+    execGraphp->addStmtsp(new AstCStmt{fl, selector + ".graphDone();\n"});
+    V3Stats::addStatSum("Optimizations, Thread schedule alternatives", alternatives.size());
+}
+
+void implementExecGraphDynamic(AstExecGraph* const execGraphp, const ThreadSchedule& schedule) {
+    // Nothing to be done if there are no MTasks in the graph at all.
+    if (execGraphp->depGraphp()->empty()) return;
+
+    AstNodeModule* const modp = v3Global.rootp()->topModulep();
+    FileLine* const fl = modp->fileline();
+    const string& tag = execGraphp->name();
+    const string doneName = "__Vm_mtaskstate_final__" + cvtToStr(schedule.id()) + tag;
+    AstBasicDType* const mtaskStateDtypep
+        = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
+
+    // Gather the mtasks, and the index of the statically scheduled thread of each.
+    // The static schedule is only used to seed the initially ready mtasks onto threads,
+    // after that the runtime steals work between threads as needed.
+    std::vector<const ExecMTask*> mtasks;
+    std::unordered_map<const ExecMTask*, uint32_t> threadIndex;
+    uint32_t nThreads = 0;
+    for (const std::vector<const ExecMTask*>& thread : schedule.threads) {
+        if (thread.empty()) continue;
+        for (const ExecMTask* const mtaskp : thread) {
+            mtasks.push_back(mtaskp);
+            threadIndex.emplace(mtaskp, nThreads);
+        }
+        ++nThreads;
+    }
+    UASSERT(!mtasks.empty(), "Non-empty ExecGraph yields no mtasks?");
+    const uint32_t nWorkers
+        = std::min<uint32_t>(v3Global.opt.threads() - 1, static_cast<uint32_t>(mtasks.size()) - 1);
+
+    // Create the entry function of each mtask, so they can refer to each other
+    std::unordered_map<const ExecMTask*, AstCFunc*> funcps;
+    for (const ExecMTask* const mtaskp : mtasks) {
+        const string name{"__Vmtask__" + tag + "__s" + cvtToStr(schedule.id()) + "__m"
+                          + cvtToStr(mtaskp->id())};
+        AstCFunc* const funcp = new AstCFunc{fl, name, nullptr, "void"};
+        modp->addStmtsp(funcp);
+        funcp->isStatic(true);  // Uses void self pointer, so static and hand rolled
+        funcp->isLoose(true);
+        funcp->entryPoint(true);
+        funcp->argTypes("void* voidSelf, bool even_cycle");
+        funcps.emplace(mtaskp, funcp);
+    }
+
+    std::vector<const ExecMTask*> roots;
+    for (const ExecMTask* const mtaskp : mtasks) {
+        AstCFunc* const funcp = funcps.at(mtaskp);
+        const auto addStrStmt = [=](const string& stmt) -> void {  //
+            funcp->addStmtsp(new AstCStmt{fl, stmt});
+        };
+        const auto addTextStmt = [=](const string& text) -> void {
+            funcp->addStmtsp(new AstText{fl, text, /* tracking: */ true});
+        };
+
+        // Count all upstream dependencies, as any of them might run on any thread
+        uint32_t nDependencies = 0;
+        for (const V3GraphEdge& edge : mtaskp->inEdges()) {
+            if (schedule.contains(edge.fromp()->as<ExecMTask>())) ++nDependencies;
+        }
+        if (nDependencies) {
+            const string name = "__Vm_mtaskstate_" + cvtToStr(mtaskp->id());
+            AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, name, mtaskStateDtypep};
+            varp->valuep(new AstConst{fl, nDependencies});
+            varp->protect(false);  // Do not protect as we still have references in AstText
+            modp->addStmtsp(varp);
+        } else {
+            roots.push_back(mtaskp);
+        }
+
+        funcp->addStmtsp(new AstCStmt{fl, EmitCBase::voidSelfAssign(modp)});
+        funcp->addStmtsp(new AstCStmt{fl, EmitCBase::symClassAssign()});
+
+        if (v3Global.opt.profPgo()) {
+            addStrStmt("vlSymsp->_vm_pgoProfiler.startCounter(" + std::to_string(mtaskp->id())
+                       + ");\n");
+        }
+
+        // Move the actual body into this function
+        funcp->addStmtsp(mtaskp->bodyp()->unlinkFrBack());
+
+        if (v3Global.opt.profPgo()) {
+            addStrStmt("vlSymsp->_vm_pgoProfiler.stopCounter(" + std::to_string(mtaskp->id())
+                       + ");\n");
+        }
+
+        // Signal every dependent mtask, and hand it to the thread pool if now ready
+        for (const V3GraphEdge& edge : mtaskp->outEdges()) {
+            const ExecMTask* const nextp = edge.top()->as<ExecMTask>();
+            if (!schedule.contains(nextp)) continue;
+            addTextStmt("if (vlSelf->__Vm_mtaskstate_" + cvtToStr(nextp->id())
+                        + ".signalUpstreamDone(even_cycle)) VlThreadPool::stealReady(");
+            funcp->addStmtsp(new AstAddrOfCFunc{fl, funcps.at(nextp)});
+            addTextStmt(");\n");
+        }
+
+        // Count this mtask as completed
+        addStrStmt("vlSelf->" + doneName + ".signalUpstreamDone(even_cycle);\n");
+    }
+
+    // Create the completion state variable
+    AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, doneName, mtaskStateDtypep};
+    varp->valuep(new AstConst(fl, mtasks.size()));
+    varp->protect(false);  // Do not protect as we still have references in AstText
+    modp->addStmtsp(varp);
+
+    // Seed and run the graph at the point this AstExecGraph is located in the tree.
+    const auto addStrStmt = [=](const string& stmt) -> void {  //
+        execGraphp->addStmtsp(new AstCStmt{fl, stmt});
+    };
+    const auto addTextStmt = [=](const string& text) -> void {
+        execGraphp->addStmtsp(new AstText{fl, text, /* tracking: */ true});
+    };
+    addStrStmt("vlSymsp->__Vm_threadPoolp->stealBegin(vlSelf, vlSymsp->__Vm_even_cycle__" + tag
+               + ", " + cvtToStr(mtasks.size()) + ");\n");
+    for (const ExecMTask* const mtaskp : roots) {
+        // The last statically scheduled thread is the main thread, which owns the last deque
+        const uint32_t index = threadIndex.at(mtaskp);
+        const uint32_t dequeIndex = index == nThreads - 1 ? nWorkers : index;
+        addTextStmt("vlSymsp->__Vm_threadPoolp->stealPush(" + cvtToStr(dequeIndex) + ", ");
+        execGraphp->addStmtsp(new AstAddrOfCFunc{fl, funcps.at(mtaskp)});
+        addTextStmt(");\n");
+    }
+    addStrStmt("vlSymsp->__Vm_threadPoolp->stealRun(" + cvtToStr(nWorkers) + ", vlSelf->"
+               + doneName + ");\n");
+    V3Stats::addStatSum("Optimizations, Thread schedule dynamic tasks", mtasks.size());
 }
 
 void implement(AstNetlist* netlistp) {
@@ -1179,6 +1461,25 @@ void implement(AstNetlist* netlistp) {
 
         addThreadStartWrapper(execGraphp);
 
+        // With --threads-alternatives, pack the alternative schedules first, then the primary
+        // schedule, so the primary schedule's predictions remain on the mtasks.
+        std::vector<AlternativeSchedule> alternatives;
+        if (v3Global.opt.threadsAlternatives() > 1) {
+            for (int i = 1; i < v3Global.opt.threadsAlternatives(); ++i) {
+                ThreadSchedule schedule = PackThreads::applyAlternative(*execGraphp->depGraphp(),
+                                                                        static_cast<uint32_t>(i));
+                std::unordered_map<const ExecMTask*, ThreadSchedule::MTaskState> state;
+                for (V3GraphVertex& vtx : execGraphp->depGraphp()->vertices()) {
+                    const ExecMTask* const mtaskp = vtx.as<const ExecMTask>();
+                    const auto it = ThreadSchedule::mtaskState.find(mtaskp);
+                    if (it == ThreadSchedule::mtaskState.end()) continue;
+                    state.emplace(*it);
+                    ThreadSchedule::mtaskState.erase(it);
+                }
+                alternatives.push_back({std::move(schedule), std::move(state)});
+            }
+        }
+
         // Schedule the mtasks: statically associate each mtask with a thread,
         // and determine the order in which each thread will run its mtasks.
         const std::vector<ThreadSchedule> packed = PackThreads::apply(*execGraphp->depGraphp());
@@ -1190,7 +1491,13 @@ void implement(AstNetlist* netlistp) {
 
         for (const ThreadSchedule& schedule : packed) {
             // Replace the graph body with its multi-threaded implementation.
-            implementExecGraph(execGraphp, schedule);
+            if (v3Global.opt.threadsDynamic()) {
+                implementExecGraphDynamic(execGraphp, schedule);
+            } else if (!alternatives.empty()) {
+                implementExecGraphAlternatives(execGraphp, schedule, alternatives);
+            } else {
+                implementExecGraph(execGraphp, schedule);
+            }
         }
 
         addThreadEndWrapper(execGraphp);
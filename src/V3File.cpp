@@ -21,12 +21,18 @@
 #include "V3Os.h"
 #include "V3String.h"
 
+#include <algorithm>
+#include <array>
 #include <cerrno>
 #include <cstdarg>
+#include <cstdio>
+#include <cstring>
 #include <fcntl.h>
+#include <fstream>
 #include <iomanip>
 #include <map>
 #include <memory>
+#include <set>
 
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -307,6 +313,58 @@ void V3File::writeTimes(const string& filename, const string& cmdlineIn) {
 bool V3File::checkTimes(const string& filename, const string& cmdlineIn) {
     return dependImp.checkTimes(filename, cmdlineIn);
 }
+// Temporary files written by V3OutFile, not yet replaced over their real file
+static V3Mutex s_tmpFilesMutex;
+static std::set<string> s_tmpFiles VL_GUARDED_BY(s_tmpFilesMutex);
+
+void V3File::addTmpFile(const string& tmpFilename) {
+    const V3LockGuard lock{s_tmpFilesMutex};
+    s_tmpFiles.insert(tmpFilename);
+}
+void V3File::removeTmpFiles() {
+    const V3LockGuard lock{s_tmpFilesMutex};
+    for (const string& tmpFilename : s_tmpFiles) std::remove(tmpFilename.c_str());
+    s_tmpFiles.clear();
+}
+void V3File::replaceIfChanged(const string& tmpFilename, const string& filename) {
+    {
+        const V3LockGuard lock{s_tmpFilesMutex};
+        s_tmpFiles.erase(tmpFilename);
+    }
+    bool identical = false;
+    {
+        std::ifstream newfs{tmpFilename, std::ios::binary};
+        std::ifstream oldfs{filename, std::ios::binary};
+        if (newfs && oldfs) {
+            std::array<char, 64 * 1024> newbuf;
+            std::array<char, 64 * 1024> oldbuf;
+            identical = true;
+            while (identical && newfs) {
+                newfs.read(newbuf.data(), newbuf.size());
+                oldfs.read(oldbuf.data(), oldbuf.size());
+                identical = newfs.gcount() == oldfs.gcount()
+                            && std::equal(newbuf.begin(), newbuf.begin() + newfs.gcount(),
+                                          oldbuf.begin());
+            }
+            identical = identical && oldfs.peek() == EOF;
+        }
+    }
+    if (identical) {
+        std::remove(tmpFilename.c_str());
+        V3Stats::addStatSum("Output, files unchanged", 1);
+        return;
+    }
+#if defined(_WIN32) || defined(__MINGW32__)
+    // Windows rename fails if the target exists
+    std::remove(filename.c_str());
+#endif
+    if (std::rename(tmpFilename.c_str(), filename.c_str()) != 0) {
+        const int err = errno;
+        std::remove(tmpFilename.c_str());
+        v3fatal("Can't write file: " << filename << ": " << std::strerror(err));
+    }
+}
+
 void V3File::createMakeDirFor(const string& filename) {
     if (filename != VL_DEV_NULL
         // If doesn't start with makeDir then some output file user requested
@@ -935,9 +993,17 @@ void V3OutFormatter::printf(const char* fmt...) {
 V3OutFile::V3OutFile(const string& filename, V3OutFormatter::Language lang)
     : V3OutFormatter{filename, lang}
     , m_bufferp{new std::array<char, WRITE_BUFFER_SIZE_BYTES>{}} {
-    if ((m_fp = V3File::new_fopen_w(filename)) == nullptr) {
-        v3fatal("Can't write file: " << filename);
+    if (v3Global.opt.outputChangedOnly() && filename != VL_DEV_NULL) {
+        // Write aside, so an identical file keeps its timestamp for make/ccache
+        m_tmpFilename = filename + ".tmp";
+        V3File::createMakeDirFor(filename);
+        V3File::addTgtDepend(filename);
+        m_fp = fopen(m_tmpFilename.c_str(), "w");
+        if (m_fp) V3File::addTmpFile(m_tmpFilename);
+    } else {
+        m_fp = V3File::new_fopen_w(filename);
     }
+    if (!m_fp) v3fatal("Can't write file: " << filename);
 }
 
 V3OutFile::~V3OutFile() {
@@ -945,6 +1011,7 @@ V3OutFile::~V3OutFile() {
 
     if (m_fp) fclose(m_fp);
     m_fp = nullptr;
+    if (!m_tmpFilename.empty()) V3File::replaceIfChanged(m_tmpFilename, filename());
 }
 
 void V3OutFile::putsForceIncs() {
@@ -62,6 +62,13 @@ public:
         addTgtDepend(filename);
         return fopen(filename.c_str(), "w");
     }
+    // Move tmpFilename over filename, or if their contents are identical,
+    // remove tmpFilename, leaving filename and its timestamp untouched
+    static void replaceIfChanged(const string& tmpFilename, const string& filename) VL_MT_SAFE;
+    // Track tmpFilename as written, but not yet passed to replaceIfChanged
+    static void addTmpFile(const string& tmpFilename) VL_MT_SAFE;
+    // Remove all tracked temporary files, when exiting on an error
+    static void removeTmpFiles() VL_MT_SAFE;
 
     // Dependencies
     static void addSrcDepend(const string& filename) VL_MT_SAFE;
@@ -202,6 +209,7 @@ class V3OutFile VL_NOT_FINAL : public V3OutFormatter {
 
     // MEMBERS
     FILE* m_fp = nullptr;
+    string m_tmpFilename;  // File being written, if replaced on close (--output-changed-only)
     std::size_t m_usedBytes = 0;  // Number of bytes stored in m_bufferp
     std::size_t m_writtenBytes = 0;  // Number of bytes written to output
     std::unique_ptr<std::array<char, WRITE_BUFFER_SIZE_BYTES>> m_bufferp;  // Write buffer
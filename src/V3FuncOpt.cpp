@@ -174,6 +174,8 @@ class FuncOptVisitor final : public VNVisitor {
     // NODE STATE
     //  AstNodeAssign::user()     -> bool.  Already checked, safe to split. Omit expensive check.
     //  AstConcat::user()         -> bool.  Already balanced.
+    // User epochs are per thread, and each visitor runs on a V3ThreadScope worker
+    const VNUser1InUse m_user1InUse;
 
     // STATE - Statistic tracking
     VDouble0 m_balancedConcats;  // Number of concatenations balanced
@@ -321,7 +323,6 @@ public:
 void V3FuncOpt::funcOptAll(AstNetlist* nodep) {
     UINFO(2, __FUNCTION__ << ":");
     {
-        const VNUser1InUse user1InUse;
         V3ThreadScope threadScope;
         for (AstNodeModule *modp = nodep->modulesp(), *nextModp; modp; modp = nextModp) {
             nextModp = VN_AS(modp->nextp(), NodeModule);
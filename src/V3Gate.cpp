@@ -273,7 +273,12 @@ class GateBuildVisitor final : public VNVisitorConst {
         iterateLogic(nodep);
     }
     void visit(AstCoverToggle* nodep) override {
-        iterateLogic(nodep, false, "CoverToggle", "CoverToggle");
+        if (m_logicVertexp) {  // Already under logic, e.g.: --coverage-toggle-stride
+            m_logicVertexp->clearReducibleAndDedupable("CoverToggle");
+            iterateChildrenConst(nodep);
+        } else {
+            iterateLogic(nodep, false, "CoverToggle", "CoverToggle");
+        }
     }
     void visit(AstSenItem* nodep) override {
         VL_RESTORER(m_inSenItem);
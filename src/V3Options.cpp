@@ -899,6 +899,26 @@ void V3Options::notify() VL_MT_DISABLED {
         m_main = false;
     }
 
+    // Per-thread counters only differ from plain counters with multiple threads
+    if (!mtasks() || !coverage()) m_coveragePerThread = false;
+
+    if (m_threadsDynamic && (m_hierarchical || m_hierChild || !m_hierBlocks.empty())) {
+        cmdfl->v3warn(E_UNSUPPORTED,
+                      "Unsupported: --threads-dynamic with hierarchical Verilation");
+        m_threadsDynamic = false;
+    }
+    if (m_threadsAlternatives > 1) {
+        if (m_hierarchical || m_hierChild || !m_hierBlocks.empty()) {
+            cmdfl->v3warn(E_UNSUPPORTED,
+                          "Unsupported: --threads-alternatives with hierarchical Verilation");
+            m_threadsAlternatives = 1;
+        } else if (m_threadsDynamic) {
+            cmdfl->v3warn(E_UNSUPPORTED,
+                          "Unsupported: --threads-alternatives with --threads-dynamic");
+            m_threadsAlternatives = 1;
+        }
+    }
+
     if (protectIds()) {
         if (allPublic()) {
             // We always call protect() on names, we don't check if public or not
@@ -1249,7 +1269,14 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-coverage-expr-max", Set, &m_coverageExprMax);
     DECL_OPTION("-coverage-line", OnOff, &m_coverageLine);
     DECL_OPTION("-coverage-max-width", Set, &m_coverageMaxWidth);
+    DECL_OPTION("-coverage-per-thread", OnOff, &m_coveragePerThread);
     DECL_OPTION("-coverage-toggle", OnOff, &m_coverageToggle);
+    DECL_OPTION("-coverage-toggle-stride", CbVal, [this, fl](const char* valp) {
+        m_coverageToggleStride = std::atoi(valp);
+        if (m_coverageToggleStride < 1) {
+            fl->v3fatal("--coverage-toggle-stride must be >= 1: " << valp);
+        }
+    });
     DECL_OPTION("-coverage-underscore", OnOff, &m_coverageUnderscore);
     DECL_OPTION("-coverage-user", OnOff, &m_coverageUser);
 
@@ -1336,6 +1363,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_fDfgPostInline = flag;
         m_fDfgScoped = flag;
     });
+    DECL_OPTION("-fdfg-break-cycles", FOnOff, &m_fDfgBreakCycles);
     DECL_OPTION("-fdfg-peephole", FOnOff, &m_fDfgPeephole);
     DECL_OPTION("-fdfg-peephole-", CbPartialMatch, [this](const char* optp) {  //
         m_fDfgPeepholeDisabled.erase(optp);
@@ -1481,6 +1509,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-order-clock-delay", CbOnOff, [fl](bool /*flag*/) {
         fl->v3warn(DEPRECATED, "Option order-clock-delay is deprecated and has no effect.");
     });
+    DECL_OPTION("-output-changed-only", OnOff, &m_outputChangedOnly);
     DECL_OPTION("-output-groups", CbVal, [this, fl](const char* valp) {
         m_outputGroups = std::atoi(valp);
         if (m_outputGroups < -1) fl->v3error("--output-groups must be >= -1: " << valp);
@@ -1634,6 +1663,13 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
                         << fl->warnMore() << "... Suggest 'all', 'none', or 'pure'");
         }
     });
+    DECL_OPTION("-threads-alternatives", CbVal, [this, fl](const char* valp) {
+        m_threadsAlternatives = std::atoi(valp);
+        if (m_threadsAlternatives < 1) {
+            fl->v3fatal("--threads-alternatives must be >= 1: " << valp);
+        }
+    });
+    DECL_OPTION("-threads-dynamic", OnOff, &m_threadsDynamic);
     DECL_OPTION("-threads-max-mtasks", CbVal, [this, fl](const char* valp) {
         m_threadsMaxMTasks = std::atoi(valp);
         if (m_threadsMaxMTasks < 1) fl->v3fatal("--threads-max-mtasks must be >= 1: " << valp);
@@ -476,7 +476,9 @@ void createInitial(AstNetlist* netlistp, const LogicClasses& logicClasses) {
 
 AstCFunc* createPostponed(AstNetlist* netlistp, const LogicClasses& logicClasses) {
     if (logicClasses.m_postponed.empty()) return nullptr;
-    AstCFunc* const funcp = makeTopFunction(netlistp, "_eval_postponed", /* slow: */ true);
+    // Sampled toggle coverage runs every eval, so is not slow code
+    const bool slow = !(v3Global.opt.coverageToggle() && v3Global.opt.coverageToggleStride());
+    AstCFunc* const funcp = makeTopFunction(netlistp, "_eval_postponed", slow);
     orderSequentially(funcp, logicClasses.m_postponed);
     splitCheck(funcp);
     return funcp;
@@ -48,6 +48,7 @@ class ScopeVisitor final : public VNVisitor {
     // STATE, inside processing a single module
     AstNodeModule* m_modp = nullptr;  // Current module
     AstScope* m_scopep = nullptr;  // Current scope we are building
+    bool m_inProcedure = false;  // Under a procedure already moved under m_scopep
     // STATE, for passing down one level of hierarchy (may need save/restore)
     AstCell* m_aboveCellp = nullptr;  // Cell that instantiates this module
     AstScope* m_aboveScopep = nullptr;  // Scope that instantiates this scope
@@ -188,6 +189,8 @@ class ScopeVisitor final : public VNVisitor {
         AstNode* const clonep = nodep->cloneTree(false);
         nodep->user2p(clonep);
         m_scopep->addBlocksp(clonep);
+        VL_RESTORER(m_inProcedure);
+        m_inProcedure = true;
         iterateChildren(clonep);  // We iterate under the *clone*
     }
     void visit(AstAssignAlias* nodep) override {
@@ -223,6 +226,12 @@ class ScopeVisitor final : public VNVisitor {
         iterateChildren(clonep);  // We iterate under the *clone*
     }
     void visit(AstCoverToggle* nodep) override {
+        // Sampled toggle coverage (--coverage-toggle-stride) sits in an
+        // AlwaysPostponed, and was moved with it, so must not be a block too
+        if (m_inProcedure) {
+            iterateChildren(nodep);
+            return;
+        }
         // Add to list of blocks under this scope
         UINFO(4, "    Move " << nodep);
         AstNode* const clonep = nodep->cloneTree(false);
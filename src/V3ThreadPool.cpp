@@ -16,6 +16,7 @@
 
 #include "V3ThreadPool.h"
 
+#include "V3Ast.h"
 #include "V3Error.h"
 #include "V3Global.h"
 #include "V3Mutex.h"
@@ -154,6 +155,22 @@ void V3ThreadPool::selfTest() {
         scope.wait();
         UASSERT(result == 1234, "unexpected job result = " << result);
     }
+
+    {
+        std::vector<int> items(100);
+        for (int i = 0; i < 100; ++i) items[i] = i;
+        std::vector<std::atomic<int>> visits(items.size());
+        for (std::atomic<int>& visit : visits) visit = 0;
+
+        V3ThreadScope scope;
+        scope.forEach<int>(items, [&](const int& item) {
+            const VNUser1InUse user1InUse;  // User epochs are per thread, so no conflict
+            ++visits[item];
+        });
+        for (size_t i = 0; i < visits.size(); ++i) {
+            UASSERT(visits[i] == 1, "item " << i << " visited " << visits[i] << " times");
+        }
+    }
     selfTestMtDisabled();
 }
 
@@ -166,3 +183,12 @@ V3ThreadScope::V3ThreadScope() {
 void V3ThreadScope::enqueue(std::function<void()>&& f) { m_pool->enqueue(std::move(f)); }
 
 void V3ThreadScope::wait() { m_pool->wait(); }
+
+void V3ThreadScope::forEachModule(AstNetlist* netlistp,
+                                  const std::function<void(AstNodeModule*)>& f) {
+    std::vector<AstNodeModule*> modps;
+    for (AstNode* nodep = netlistp->modulesp(); nodep; nodep = nodep->nextp()) {
+        modps.push_back(VN_AS(nodep, NodeModule));
+    }
+    forEach<AstNodeModule*>(modps, [&f](AstNodeModule* const& modp) { f(modp); });
+}
@@ -23,11 +23,16 @@
 
 #include "V3Mutex.h"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <queue>
 #include <thread>
+#include <vector>
+
+class AstNetlist;
+class AstNodeModule;
 
 //============================================================================
 
@@ -64,6 +69,9 @@ private:
     // Wait for all enqueued jobs to finish
     void wait() VL_MT_SAFE;
 
+    // Number of jobs that can usefully run at once
+    size_t concurrency() const VL_MT_SAFE { return m_workers.empty() ? 1 : m_workers.size(); }
+
     // Job execution loop
     // Each worker wait for available job and executes it when it is available.
     void workerJobLoop() VL_MT_SAFE VL_EXCLUDES(m_mutex);
@@ -93,6 +101,27 @@ public:
     void enqueue(std::function<void()>&& f) VL_MT_START;
     // Wait for thread pool's jobs completion
     void wait() VL_MT_SAFE VL_REQUIRES(VlOs::MtScopeMutex::s_haveThreadScope);
+
+    // Call 'f' on each element of 'items' on the thread pool, and wait for completion.
+    // Each job takes the next unprocessed element when done with its previous one,
+    // so elements of very different cost are balanced across threads.
+    template <typename T_Item>
+    void forEach(const std::vector<T_Item>& items,
+                 const std::function<void(const T_Item&)>& f) VL_MT_START {
+        std::atomic<size_t> next{0};
+        const size_t nJobs = std::min(m_pool->concurrency(), items.size());
+        for (size_t i = 0; i < nJobs; ++i) {
+            enqueue([&items, &f, &next]() {
+                for (size_t j = next++; j < items.size(); j = next++) f(items[j]);
+            });
+        }
+        wait();
+    }
+    // Call 'f' on each module of 'netlistp' on the thread pool, as with forEach. 'f' may
+    // use VNUser*InUse (user*() epochs are per thread), but must only access nodes under
+    // the module it was given, and must not add or remove modules.
+    void forEachModule(AstNetlist* netlistp,
+                       const std::function<void(AstNodeModule*)>& f) VL_MT_START;
 };
 
 #endif  // Guard
@@ -184,9 +184,13 @@ class TraceVisitor final : public VNVisitor {
     TraceActivityVertex* const m_alwaysVtxp;  // "Always trace" vertex
     bool m_finding = false;  // Pass one of algorithm?
 
-    // Trace parallelism. Only VCD tracing can be parallelized at this time.
+    // Trace parallelism. Only VCD tracing can be parallelized at this time. Split into a few
+    // functions per thread, which the runtime hands out to idle threads to balance the load.
+    static constexpr uint32_t PARALLEL_FUNCS_PER_THREAD = 4;
     const uint32_t m_parallelism
-        = v3Global.opt.useTraceParallel() ? static_cast<uint32_t>(v3Global.opt.threads()) : 1;
+        = v3Global.opt.useTraceParallel()
+              ? static_cast<uint32_t>(v3Global.opt.threads()) * PARALLEL_FUNCS_PER_THREAD
+              : 1;
 
     VDouble0 m_statSetters;  // Statistic tracking
     VDouble0 m_statSettersSlow;  // Statistic tracking
@@ -270,16 +270,15 @@ void V3VariableOrder::orderAll(AstNetlist* netlistp) {
 
     // Sort variables for each module
     std::unordered_map<AstNodeModule*, std::vector<AstVar*>> sortedVars;
+    for (AstNodeModule* modp = netlistp->modulesp(); modp;
+         modp = VN_AS(modp->nextp(), NodeModule)) {
+        sortedVars[modp];  // Insert all up front, the workers only look up
+    }
     {
         V3ThreadScope threadScope;
-
-        for (AstNodeModule* modp = v3Global.rootp()->modulesp(); modp;
-             modp = VN_AS(modp->nextp(), NodeModule)) {
-            std::vector<AstVar*>& varps = sortedVars[modp];
-            threadScope.enqueue([modp, mTaskAffinity, &varps]() {
-                VariableOrder::processModule(modp, mTaskAffinity, varps);
-            });
-        }
+        threadScope.forEachModule(netlistp, [&](AstNodeModule* modp) {
+            VariableOrder::processModule(modp, mTaskAffinity, sortedVars.at(modp));
+        });
     }
     if (v3Global.opt.stats()) V3Stats::statsStage("variableorder-sort");
 
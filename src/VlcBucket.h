@@ -25,6 +25,9 @@
 #endif
 #include "V3Error.h"
 
+#include <algorithm>
+#include <bitset>
+
 //********************************************************************
 // VlcBuckets - Container of all coverage point hits for a given test
 // This is a bitmap array - we store a single bit to indicate a test
@@ -37,6 +40,8 @@ class VlcBuckets final {
     uint64_t m_bucketsCovered = 0;  ///< Num buckets with sufficient coverage
 
     static uint64_t covBit(uint64_t point) { return 1ULL << (point & 63); }
+    static uint64_t countOnes(uint64_t word) { return std::bitset<64>{word}.count(); }
+    uint64_t words() const { return m_dataSize / 64; }
     uint64_t allocSize() const { return sizeof(uint64_t) * m_dataSize / 64; }
     void allocate(uint64_t point) {
         const uint64_t oldsize = m_dataSize;
@@ -63,6 +68,7 @@ public:
 
     // ACCESSORS
     static uint64_t sufficient() { return 1; }
+    uint64_t dataSize() const { return m_dataSize; }
     uint64_t bucketsCovered() const { return m_bucketsCovered; }
 
     // METHODS
@@ -95,24 +101,22 @@ public:
             return (m_datap[point / 64] & covBit(point)) ? 1 : 0;
         }
     }
+    // Operate on whole words, which the compiler may vectorize
     uint64_t popCount() const {
         uint64_t pop = 0;
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i)) ++pop;
-        }
+        for (uint64_t w = 0; w < words(); ++w) pop += countOnes(m_datap[w]);
         return pop;
     }
-    uint64_t dataPopCount(const VlcBuckets& remaining) {
+    uint64_t dataPopCount(const VlcBuckets& remaining) const {
+        const uint64_t nwords = std::min(words(), remaining.words());
         uint64_t pop = 0;
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i) && remaining.hits(i)) ++pop;
-        }
+        for (uint64_t w = 0; w < nwords; ++w) pop += countOnes(m_datap[w] & remaining.m_datap[w]);
         return pop;
     }
     void orData(const VlcBuckets& ordata) {
-        for (uint64_t i = 0; i < m_dataSize; ++i) {
-            if (hits(i) && ordata.hits(i)) clearHits(i);
-        }
+        // Clear hits that ordata has covered
+        const uint64_t nwords = std::min(words(), ordata.words());
+        for (uint64_t w = 0; w < nwords; ++w) m_datap[w] &= ~ordata.m_datap[w];
     }
 
     void dump() const {
@@ -40,10 +40,12 @@ class VlcOptions final {
     int m_annotateMin = 10;     // main switch: --annotate-min I<count>
     bool m_annotatePoints = false;  // main switch: --annotate-points
     string m_filterType = "*";  // main switch: --filter-type
+    int m_jobs = 1;             // main switch: -j
     VlStringSet m_readFiles;    // main switch: --read
     bool m_rank = false;        // main switch: --rank
     bool m_unlink = false;      // main switch: --unlink
     string m_writeFile;         // main switch: --write
+    string m_writeBinaryFile;   // main switch: --write-binary
     string m_writeInfoFile;     // main switch: --write-info
     // clang-format on
 
@@ -67,9 +69,11 @@ public:
     int annotateMin() const { return m_annotateMin; }
     bool countOk(uint64_t count) const { return count >= static_cast<uint64_t>(m_annotateMin); }
     bool annotatePoints() const { return m_annotatePoints; }
+    int jobs() const { return m_jobs; }
     bool rank() const { return m_rank; }
     bool unlink() const { return m_unlink; }
     string writeFile() const { return m_writeFile; }
+    string writeBinaryFile() const { return m_writeBinaryFile; }
     string writeInfoFile() const { return m_writeInfoFile; }
     bool isTypeMatch(const char* name) const {
         return VString::wildmatch(VlcPoint::typeExtract(name), m_filterType);
@@ -54,7 +54,7 @@ public:
     uint64_t testsCovering() const { return m_testsCovering; }
     void countInc(uint64_t inc) { m_count += inc; }
     uint64_t count() const { return m_count; }
-    void testsCoveringInc() { m_testsCovering++; }
+    void testsCoveringInc(uint64_t inc = 1) { m_testsCovering += inc; }
     bool ok(unsigned annotateMin) const {
         const std::string threshStr = thresh();
         unsigned threshi = !threshStr.empty() ? std::atoi(threshStr.c_str()) : annotateMin;
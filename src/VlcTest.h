@@ -52,6 +52,7 @@ public:
     double computrons() const { return m_computrons; }
     uint64_t testrun() const { return m_testrun; }
     VlcBuckets& buckets() { return m_buckets; }
+    const VlcBuckets& buckets() const { return m_buckets; }
     uint64_t bucketsCovered() const { return m_buckets.bucketsCovered(); }
     uint64_t rank() const { return m_rank; }
     void rank(uint64_t flag) { m_rank = flag; }
@@ -118,6 +119,14 @@ public:
         m_tests.push_back(testp);
         return testp;
     }
+    // Take ownership of a test made elsewhere
+    void adopt(VlcTest* testp) { m_tests.push_back(testp); }
+    // Release ownership of all tests to caller
+    ByName release() {
+        ByName tests;
+        tests.swap(m_tests);
+        return tests;
+    }
     void clearUser() {
         for (const auto& testp : m_tests) testp->user(0);
     }
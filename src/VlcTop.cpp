@@ -24,23 +24,49 @@
 #include "VlcOptions.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <fstream>
+#include <memory>
+#include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 //######################################################################
 
+void VlcTop::readError(const string& filename, const string& msg) {
+    if (m_deferErrors) {
+        m_readErrors.emplace(filename, msg);
+    } else {
+        v3fatal(msg);
+    }
+}
+
 void VlcTop::readCoverage(const string& filename, bool nonfatal) {
-    UINFO(2, "readCoverage " << filename);
+    if (!m_deferErrors) UINFO(2, "readCoverage " << filename);
 
     std::ifstream is{filename.c_str()};
     if (!is) {
-        if (!nonfatal) v3fatal("Can't read coverage file: " << filename);
+        if (!nonfatal) readError(filename, "Can't read coverage file: " + filename);
         return;
     }
 
+    {
+        char magic[VerilatedCovBinary::MAGIC_SIZE];
+        is.read(magic, sizeof(magic));
+        if (is.gcount() == sizeof(magic)
+            && std::memcmp(magic, VerilatedCovBinary::magic(), sizeof(magic)) == 0) {
+            readCoverageBinary(filename);
+            return;
+        }
+        is.clear();
+        is.seekg(0);
+    }
+
     // Testrun and computrons argument unsupported as yet
-    VlcTest* const testp = tests().newTest(filename, 0, 0);
+    // Tests are only needed for ranking, so otherwise keep just the point counts
+    VlcTest* const testp = opt.rank() ? tests().newTest(filename, 0, 0) : nullptr;
 
     while (!is.eof()) {
         const string line = V3Os::getline(is);
@@ -67,6 +93,189 @@ void VlcTop::readCoverage(const string& filename, bool nonfatal) {
     }
 }
 
+void VlcTop::readCoverages(const VlStringSet& filenames) {
+    const size_t jobs = std::min<size_t>(
+        opt.jobs() > 0 ? opt.jobs() : std::max(1U, std::thread::hardware_concurrency()),
+        filenames.size());
+    if (jobs <= 1) {
+        for (const auto& filename : filenames) readCoverage(filename);
+        return;
+    }
+
+    // Each thread reads files into its own shard, then the shards are merged
+    UINFO(2, "readCoverages with " << jobs << " threads");
+    const std::vector<string> files{filenames.begin(), filenames.end()};
+    for (const string& filename : files) UINFO(2, "readCoverage " << filename);
+    std::vector<std::unique_ptr<VlcTop>> shards;
+    std::vector<std::thread> threads;
+    std::atomic<size_t> nextFile{0};
+    for (size_t i = 0; i < jobs; ++i) {
+        shards.emplace_back(new VlcTop);
+        shards.back()->opt = opt;
+        shards.back()->m_deferErrors = true;
+        VlcTop* const shardp = shards.back().get();
+        threads.emplace_back([&files, &nextFile, shardp]() {
+            for (size_t f = nextFile++; f < files.size(); f = nextFile++) {
+                shardp->readCoverage(files[f]);
+            }
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+
+    // Report the error of the first file that failed, as reading in order would
+    for (const string& filename : files) {
+        for (const auto& shardp : shards) {
+            const auto it = shardp->m_readErrors.find(filename);
+            if (it != shardp->m_readErrors.end()) v3fatal(it->second);
+        }
+    }
+
+    std::map<string, VlcTest*> shardTests;  // Test in its shard, by test name
+    for (const auto& shardp : shards) mergeShard(*shardp, shardTests);
+    // Tests in the same order as when reading without threads
+    for (const string& filename : files) {
+        const auto it = shardTests.find(filename);
+        if (it != shardTests.end()) m_tests.adopt(it->second);
+    }
+}
+
+void VlcTop::mergeShard(VlcTop& shard, std::map<string, VlcTest*>& shardTests) {
+    // Add points of shard, and move its tests into shardTests with buckets
+    // renumbered to this top's point numbers
+    std::vector<uint64_t> pointnums;
+    for (const auto& i : shard.points()) {
+        const VlcPoint& point = shard.points().pointNumber(i.second);
+        const uint64_t pointnum = points().findAddPoint(point.name(), point.count());
+        points().pointNumber(pointnum).testsCoveringInc(point.testsCovering());
+        if (pointnums.size() <= i.second) pointnums.resize(i.second + 1);
+        pointnums[i.second] = pointnum;
+    }
+    for (VlcTest* const shardTestp : shard.tests().release()) {
+        VlcTest* const testp
+            = new VlcTest{shardTestp->name(), shardTestp->testrun(), shardTestp->computrons()};
+        const VlcBuckets& buckets = shardTestp->buckets();
+        for (uint64_t point = 0; point < buckets.dataSize(); ++point) {
+            if (buckets.hits(point)) testp->buckets().addData(pointnums[point], 1);
+        }
+        VL_DO_DANGLING(delete shardTestp, shardTestp);
+        shardTests.emplace(testp->name(), testp);
+    }
+}
+
+void VlcTop::readCoverageBinary(const string& filename) {
+    if (!m_deferErrors) UINFO(2, "readCoverageBinary " << filename);
+
+    // Read the whole file at once, see VerilatedCovBinary for the format
+    std::ifstream is{filename.c_str(), std::ios::binary | std::ios::ate};
+    string data(static_cast<size_t>(std::max<std::streamoff>(is.tellg(), 0)), '\0');
+    is.seekg(0);
+    is.read(&data[0], data.size());
+    const char* cp = data.data() + VerilatedCovBinary::MAGIC_SIZE;
+    const char* const endp = data.data() + data.size();
+
+    uint32_t header[2];  // Version, endian mark
+    uint64_t layoutSize;
+    if (static_cast<size_t>(endp - cp) < sizeof(header) + sizeof(layoutSize)) {
+        readError(filename, "Truncated binary coverage file: " + filename);
+        return;
+    }
+    std::memcpy(header, cp, sizeof(header));
+    cp += sizeof(header);
+    std::memcpy(&layoutSize, cp, sizeof(layoutSize));
+    cp += sizeof(layoutSize);
+    if (header[0] != VerilatedCovBinary::VERSION || header[1] != VerilatedCovBinary::ENDIAN_MARK) {
+        readError(filename,
+                  "Binary coverage file has unsupported version or byte order: " + filename);
+        return;
+    }
+    if (layoutSize > static_cast<uint64_t>(endp - cp)) {
+        readError(filename, "Truncated binary coverage file: " + filename);
+        return;
+    }
+
+    // Files from the same model share the same layout, so only the first
+    // needs to look up the point names
+    const string layout{cp, static_cast<size_t>(layoutSize)};
+    cp += layoutSize;
+    auto it = m_binaryLayouts.find(layout);
+    if (it == m_binaryLayouts.end()) {
+        std::vector<uint64_t> pointnums = binaryLayoutPoints(filename, layout);
+        if (m_readErrors.count(filename)) return;  // Corrupt layout, don't reuse it
+        it = m_binaryLayouts.emplace(layout, std::move(pointnums)).first;
+    }
+    const std::vector<uint64_t>& pointnums = it->second;
+    if (static_cast<size_t>(endp - cp) != pointnums.size() * sizeof(uint64_t)) {
+        readError(filename, "Truncated binary coverage file: " + filename);
+        return;
+    }
+
+    // Testrun and computrons argument unsupported as yet
+    // Tests are only needed for ranking, so otherwise keep just the point counts
+    VlcTest* const testp = opt.rank() ? tests().newTest(filename, 0, 0) : nullptr;
+
+    for (const uint64_t pointnum : pointnums) {
+        uint64_t hits;
+        std::memcpy(&hits, cp, sizeof(hits));
+        cp += sizeof(hits);
+        if (pointnum == NO_POINT) continue;
+        points().pointNumber(pointnum).countInc(hits);
+        if (opt.rank()) {  // Only if ranking - uses a lot of memory
+            if (hits >= VlcBuckets::sufficient()) {
+                points().pointNumber(pointnum).testsCoveringInc();
+                testp->buckets().addData(pointnum, hits);
+            }
+        }
+    }
+}
+
+std::vector<uint64_t> VlcTop::binaryLayoutPoints(const string& filename, const string& layout) {
+    // Return point number of each point in a binary coverage file's layout section
+    std::vector<uint64_t> pointnums;
+    const char* cp = layout.data();
+    const char* const endp = cp + layout.size();
+    const auto get = [&](void* datap, size_t size) {
+        if (static_cast<size_t>(endp - cp) < size) return false;
+        std::memcpy(datap, cp, size);
+        cp += size;
+        return true;
+    };
+
+    uint64_t numStrings = 0;
+    if (!get(&numStrings, sizeof(numStrings))) numStrings = 0;
+    std::vector<string> strings;
+    for (uint64_t i = 0; i < numStrings; ++i) {
+        uint32_t len = 0;
+        if (!get(&len, sizeof(len)) || static_cast<size_t>(endp - cp) < len) {
+            readError(filename, "Corrupt binary coverage file: " + filename);
+            return pointnums;
+        }
+        strings.emplace_back(cp, len);
+        cp += len;
+    }
+    uint64_t numPoints = 0;
+    if (!get(&numPoints, sizeof(numPoints))
+        || static_cast<uint64_t>(endp - cp) != numPoints * 2 * sizeof(uint32_t)) {
+        readError(filename, "Corrupt binary coverage file: " + filename);
+        return pointnums;
+    }
+    pointnums.reserve(numPoints);
+    for (uint64_t i = 0; i < numPoints; ++i) {
+        uint32_t indexes[2];  // Name, hier
+        get(indexes, sizeof(indexes));
+        if (indexes[0] >= strings.size()
+            || (indexes[1] != VerilatedCovBinary::NO_STRING && indexes[1] >= strings.size())) {
+            readError(filename, "Corrupt binary coverage file: " + filename);
+            pointnums.clear();
+            return pointnums;
+        }
+        string point = strings[indexes[0]];
+        if (indexes[1] != VerilatedCovBinary::NO_STRING) point += strings[indexes[1]];
+        pointnums.push_back(opt.isTypeMatch(point.c_str()) ? points().findAddPoint(point, 0)
+                                                           : NO_POINT);
+    }
+    return pointnums;
+}
+
 void VlcTop::writeCoverage(const string& filename) {
     UINFO(2, "writeCoverage " << filename);
 
@@ -83,6 +292,32 @@ void VlcTop::writeCoverage(const string& filename) {
     }
 }
 
+void VlcTop::writeCoverageBinary(const string& filename) {
+    UINFO(2, "writeCoverageBinary " << filename);
+
+    std::ofstream os{filename.c_str(), std::ios::binary};
+    if (!os) {
+        v3fatal("Can't write file: " << filename);
+        return;
+    }
+
+    // Split off the hierarchy, which is last in the name when present, so
+    // that it is shared across points
+    VerilatedCovBinaryWriter writer;
+    const string hierKey = "\001"s + VL_CIK_HIER + "\002";
+    for (const auto& i : m_points) {
+        const VlcPoint& point = m_points.pointNumber(i.second);
+        const string& name = point.name();
+        const size_t hierPos = name.rfind(hierKey);
+        if (hierPos != string::npos && name.find('\001', hierPos + 1) == string::npos) {
+            writer.addPoint(name.substr(0, hierPos), name.substr(hierPos), point.count());
+        } else {
+            writer.addPoint(name, "", point.count());
+        }
+    }
+    writer.write(os);
+}
+
 void VlcTop::writeInfo(const string& filename) {
     UINFO(2, "writeInfo " << filename);
 
@@ -175,33 +410,39 @@ void VlcTop::rank() {
         if (pointp->testsCovering()) remaining.addData(pointp->pointNum(), 1);
     }
 
-    // Additional Greedy algorithm
-    // O(n^2) Ouch.  Probably the thing to do is randomize the order of data
-    // then hierarchically solve a small subset of tests, and take resulting
-    // solution and move up to larger subset of tests.  (Aka quick sort.)
-    while (true) {
+    // Additional Greedy algorithm, choosing the test covering the most
+    // remaining points, the earliest in bytime order on ties.
+    // A test's remaining points only decrease as other tests are chosen, so
+    // a previously computed count is an upper bound (lazy greedy).  Keep
+    // tests in a heap ordered by their bound; when the top test's
+    // recomputed count still beats the next best bound, it is the best test.
+    using Candidate = std::pair<uint64_t, size_t>;  // Remaining points bound, bytime index
+    const auto cmpCandidate = [](const Candidate& lhs, const Candidate& rhs) {
+        if (lhs.first != rhs.first) return lhs.first < rhs.first;
+        return lhs.second > rhs.second;
+    };
+    std::priority_queue<Candidate, std::vector<Candidate>, decltype(cmpCandidate)> candidates{
+        cmpCandidate};
+    for (size_t i = 0; i < bytime.size(); ++i) {
+        candidates.emplace(bytime[i]->buckets().dataPopCount(remaining), i);
+    }
+    while (!candidates.empty()) {
+        const size_t i = candidates.top().second;
+        candidates.pop();
+        VlcTest* const testp = bytime[i];
+        const Candidate current{testp->buckets().dataPopCount(remaining), i};
+        if (!current.first) continue;  // Covers nothing more, so never will
+        if (!candidates.empty() && cmpCandidate(current, candidates.top())) {
+            candidates.push(current);  // Another test may be better, re-examine later
+            continue;
+        }
         if (debug() >= 9) {
             UINFO_PREFIX("Left on iter" << nextrank << ": ");  // LCOV_EXCL_LINE
             remaining.dump();  // LCOV_EXCL_LINE
         }
-        VlcTest* bestTestp = nullptr;
-        uint64_t bestRemain = 0;
-        for (const auto& testp : bytime) {
-            if (!testp->rank()) {
-                uint64_t remain = testp->buckets().dataPopCount(remaining);
-                if (remain > bestRemain) {
-                    bestTestp = testp;
-                    bestRemain = remain;
-                }
-            }
-        }
-        if (VlcTest* const testp = bestTestp) {
-            testp->rank(nextrank++);
-            testp->rankPoints(bestRemain);
-            remaining.orData(bestTestp->buckets());
-        } else {
-            break;  // No test covering more stuff found
-        }
+        testp->rank(nextrank++);
+        testp->rankPoints(current.first);
+        remaining.orData(testp->buckets());
     }
 }
 
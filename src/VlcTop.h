@@ -25,6 +25,10 @@
 #include "VlcSource.h"
 #include "VlcTest.h"
 
+#include <map>
+#include <unordered_map>
+#include <vector>
+
 //######################################################################
 // VlcTop - Top level options container
 
@@ -37,8 +41,20 @@ private:
     VlcTests m_tests;  //< List of all tests (all coverage files)
     VlcPoints m_points;  //< List of all points
     VlcSources m_sources;  //< List of all source files to annotate
+    // Layout section of binary coverage files read, to the point number of
+    // each point in it, or NO_POINT if filtered out
+    std::unordered_map<string, std::vector<uint64_t>> m_binaryLayouts;
+    static constexpr uint64_t NO_POINT = ~0ULL;
+    // Errors are not thread safe, so a shard read by a readCoverages thread
+    // records them, and the main thread reports them
+    bool m_deferErrors = false;  // Record instead of reporting errors
+    std::map<string, string> m_readErrors;  // Recorded error, by filename
 
     // METHODS
+    void readError(const string& filename, const string& msg);
+    void readCoverageBinary(const string& filename);
+    void mergeShard(VlcTop& shard, std::map<string, VlcTest*>& shardTests);
+    std::vector<uint64_t> binaryLayoutPoints(const string& filename, const string& layout);
     void annotateCalc();
     void annotateCalcNeeded();
     void annotateOutputFiles(const string& dirname);
@@ -56,7 +72,9 @@ public:
     // METHODS
     void annotate(const string& dirname);
     void readCoverage(const string& filename, bool nonfatal = false);
+    void readCoverages(const VlStringSet& filenames);
     void writeCoverage(const string& filename);
+    void writeCoverageBinary(const string& filename);
     void writeInfo(const string& filename);
 
     void rank();
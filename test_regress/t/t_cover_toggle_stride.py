@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.top_filename = "t/t_cover_toggle.v"
+
+test.compile(verilator_flags2=['--cc --coverage-toggle --coverage-toggle-stride 2'])
+
+# Toggles are checked in the postponed region, every second eval
+test.file_grep_any(test.glob_some(test.obj_dir + "/" + test.vm_prefix + "___024root*.cpp"),
+                   r'_eval_postponed')
+test.file_grep_any(test.glob_some(test.obj_dir + "/" + test.vm_prefix + "___024root*.cpp"),
+                   r'__Vtogcov_sample')
+
+# No toggle check may be left in combinational logic, only in the postponed region
+for filename in test.glob_some(test.obj_dir + "/" + test.vm_prefix + "___024root*.cpp"):
+    funcname = None
+    with open(filename, 'r', encoding="utf8") as fh:
+        for line in fh:
+            m = re.match(r'^\S.*\b(\w+)\(.*\)\s*\{\s*$', line)
+            if m:
+                funcname = m.group(1)
+            if re.search(r'\+\+\(vlSymsp->__Vcoverage\[|__Vcoverage\[\d+\]\.fetch_add', line):
+                if not funcname or 'postponed' not in funcname:
+                    test.error("Toggle check outside postponed region, in " + str(funcname) +
+                               " of " + filename)
+
+test.execute()
+
+# Sampling may miss toggles, so only check points were recorded and some toggled
+test.file_grep(test.obj_dir + "/coverage.dat", r"v_toggle/t.*' [1-9]")
+
+test.passes()
@@ -0,0 +1,33 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Write runtime coverage in text and binary formats
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_cov.h>
+
+#include <memory>
+
+#include VM_PREFIX_INCLUDE
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get()}};
+
+    topp->clk = 0;
+    while (!contextp->gotFinish() && contextp->time() < 1000) {
+        topp->eval();
+        contextp->timeInc(1);
+        topp->clk = !topp->clk;
+    }
+    topp->final();
+
+    const std::string prefix = std::string{VL_STRINGIFY(TEST_OBJ_DIR)} + "/coverage";
+    contextp->coveragep()->write(prefix + ".dat");
+    contextp->coveragep()->writeBinary(prefix + ".datb");
+    return 0;
+}
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(v_flags2=["--coverage", test.pli_filename],
+             verilator_flags2=["--exe"],
+             make_flags=['CPPFLAGS_ADD=-DTEST_OBJ_DIR="' + test.obj_dir + '"'],
+             make_top_shell=False,
+             make_main=False)
+
+test.execute()
+
+
+def read_counts(filename):
+    counts = {}
+    with open(filename, 'r', encoding="utf8") as fh:
+        for line in fh:
+            m = re.match(r"^C '(.*)' (\d+)$", line)
+            if m:
+                counts[m.group(1)] = int(m.group(2))
+    return counts
+
+
+# Binary written by the model must read back identical to the text it wrote
+test.run(cmd=[
+    os.environ["VERILATOR_ROOT"] + "/bin/verilator_coverage",
+    "--write",
+    test.obj_dir + "/coverage_from_binary.dat",
+    test.obj_dir + "/coverage.datb",
+],
+         verilator_run=True)
+
+test.files_identical_sorted(test.obj_dir + "/coverage_from_binary.dat",
+                            test.obj_dir + "/coverage.dat")
+
+# Merging the binary with the text form must double every point
+test.run(cmd=[
+    os.environ["VERILATOR_ROOT"] + "/bin/verilator_coverage",
+    "--write",
+    test.obj_dir + "/coverage_merged.dat",
+    test.obj_dir + "/coverage.dat",
+    test.obj_dir + "/coverage.datb",
+],
+         verilator_run=True)
+
+text = read_counts(test.obj_dir + "/coverage.dat")
+merged = read_counts(test.obj_dir + "/coverage_merged.dat")
+if not text:
+    test.error("No coverage points written")
+if sorted(merged.keys()) != sorted(text.keys()):
+    test.error("Merged coverage points differ from the model's points")
+for point, count in text.items():
+    if merged[point] != 2 * count:
+        test.error("Point " + point + " merged to " + str(merged[point]) + ", expected " +
+                   str(2 * count))
+
+test.passes()
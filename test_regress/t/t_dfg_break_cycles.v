@@ -0,0 +1,56 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+`define stop $stop
+`define check(got ,exp) do if ((got) !== (exp)) begin $write("%%Error: %s:%0d: cyc=%0d got='h%x exp='h%x\n", `__FILE__,`__LINE__, cyc, (got), (exp)); `stop; end while(0)
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   reg [31:0] cyc = 0;
+   reg [7:0] in = 8'h5a;
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      in <= in * 8'd13 + 8'd7;
+      if (cyc == 99) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+   // False loops through a vector, with logic to optimize on the loop
+   // verilator lint_off UNOPTFLAT
+   wire [7:0] prefix;
+   assign prefix[0] = ~~in[0];
+   assign prefix[7:1] = (prefix[6:0] ^ in[7:1]) & ~(in[7:1] & ~in[7:1]);
+
+   wire [7:0] chain;
+   assign chain[0] = in[0] & in[0];
+   assign chain[7:1] = (chain[6:0] | in[7:1]) ^ (chain[6:0] & 7'h00);
+   // verilator lint_on UNOPTFLAT
+
+   // Reference values
+   reg [7:0] prefixExp;
+   reg [7:0] chainExp;
+   always_comb begin
+      prefixExp[0] = in[0];
+      chainExp[0] = in[0];
+      for (int i = 1; i < 8; ++i) begin
+         prefixExp[i] = prefixExp[i - 1] ^ in[i];
+         chainExp[i] = chainExp[i - 1] | in[i];
+      end
+   end
+
+   always @ (negedge clk) begin
+      `check(prefix, prefixExp);
+      `check(chain, chainExp);
+   end
+
+endmodule
@@ -0,0 +1,40 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+import time
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_skipidentical.v"
+
+flags = ['--output-changed-only', '--no-skip-identical', '--stats']
+
+test.compile(verilator_flags2=flags)
+
+outfile = test.obj_dir + "/V" + test.name + ".cpp"
+oldstats = os.path.getmtime(outfile)
+print("Old mtime=", oldstats)
+
+time.sleep(2)  # Or else it might take < 1 second to compile and see no diff.
+
+test.compile(verilator_flags2=flags)
+
+newstats = os.path.getmtime(outfile)
+print("New mtime=", newstats)
+
+if oldstats != newstats:
+    test.error("--output-changed-only rewrote an identical file")
+
+test.file_grep(test.stats, r'Output, files unchanged\s+[1-9]')
+
+tmpfiles = [f for f in os.listdir(test.obj_dir) if f.endswith(".tmp")]
+if tmpfiles:
+    test.error("--output-changed-only left temporary files: " + " ".join(tmpfiles))
+
+test.passes()
@@ -13,6 +13,11 @@ test.scenarios('simulator')
 
 test.compile(v_flags2=["--savable"], save_time=500)
 
+if test.vlt_all:
+    # Arrays of integral data are saved as raw memory
+    files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp")
+    test.file_grep_any(files, r'os\.write\(&vec, sizeof\(vec\)\);')
+
 test.execute(check_finished=False, all_run_flags=['+save_time=500'])
 
 if not os.path.exists(test.obj_dir + "/saved.vltsv"):
@@ -0,0 +1,81 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static std::string checkpointFilename(uint64_t time) {
+    return std::string{VL_STRINGIFY(TEST_OBJ_DIR) "/saved_"} + std::to_string(time) + ".vltsv";
+}
+
+int main(int argc, char* argv[]) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+
+    const std::vector<uint64_t> saveTimes{100, 300, 500};
+    const bool restore = contextp->commandArgsPlusMatch("save_restore=")[0];
+
+    if (restore) {
+        std::vector<std::string> filenames;
+        for (const uint64_t time : saveTimes) filenames.push_back(checkpointFilename(time));
+        VL_PRINTF("Restoring model from '%s'\n", filenames.back().c_str());
+        VerilatedRestore os;
+        os.openChain(filenames);
+        TEST_CHECK_EQ(os.isOpen(), true);
+        os >> *topp;
+        os.close();
+        TEST_CHECK_EQ(contextp->time(), saveTimes.back());
+    } else {
+        topp->clk = 0;
+        topp->eval();
+    }
+
+    // Blocks small enough that each checkpoint after the first is partial
+    VerilatedSaveDelta delta{64};
+    while (contextp->time() < 2000 && !contextp->gotFinish()) {
+        if (!restore) {
+            for (const uint64_t time : saveTimes) {
+                if (contextp->time() != time) continue;
+                VL_PRINTF("Saving model to '%s'\n", checkpointFilename(time).c_str());
+                VerilatedSave os;
+                os.openDelta(checkpointFilename(time).c_str(), delta);
+                TEST_CHECK_EQ(os.isOpen(), true);
+                os << *topp;
+                os.close();
+            }
+            if (contextp->time() == saveTimes.back()) {
+                VL_PRINTF("Exiting after save_model\n");
+                TEST_CHECK_EQ(delta.sequence(), saveTimes.size());
+                return errors ? 10 : 0;
+            }
+        }
+        contextp->timeInc(5);
+        topp->clk = !topp->clk;
+        topp->eval();
+    }
+    if (!contextp->gotFinish()) {
+        vl_fatal(__FILE__, __LINE__, "main", "%Error: Timeout; never got a $finish");
+    }
+    topp->final();
+
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_savable.v"
+
+test.compile(v_flags2=["--savable --exe", test.pli_filename], make_main=False)
+
+test.execute(check_finished=False)
+
+full_size = os.path.getsize(test.obj_dir + "/saved_100.vltsv")
+for time in (300, 500):
+    filename = test.obj_dir + "/saved_" + str(time) + ".vltsv"
+    if not os.path.exists(filename):
+        test.error("Delta checkpoint not created: " + filename)
+    elif os.path.getsize(filename) >= full_size:
+        test.error("Delta checkpoint not smaller than full checkpoint: " + filename)
+
+test.execute(all_run_flags=['+save_restore=1'])
+
+test.passes()
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_gen_alw.v"  # Any, as long as has a few mtasks
+
+test.compile(verilator_flags2=['--cc --trace-vcd --threads-alternatives 3 --stats'], threads=4)
+
+# Never select, keep the primary schedule
+test.execute(all_run_flags=["+verilator+threads+warmup+0"])
+os.rename(test.trace_filename, test.obj_dir + "/primary.vcd")
+
+# Select a schedule after a short warm-up. With an odd warm-up the selected
+# schedule first runs on an odd cycle of the primary schedule.
+for warmup in (1, 2, 3):
+    test.execute(all_run_flags=["+verilator+threads+warmup+" + str(warmup)])
+    test.vcd_identical(test.trace_filename, test.obj_dir + "/primary.vcd")
+
+test.file_grep(test.stats, r'Optimizations, Thread schedule alternatives\s+(\d+)')
+
+test.passes()
@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_gen_alw.v"  # Any, fails before simulating
+
+test.compile(threads=2)
+
+test.execute(all_run_flags=["+verilator+threads+cpus+a-3"],
+             fails=True,
+             expect_filename="t/" + test.name + "__a.out")
+
+test.execute(all_run_flags=["+verilator+threads+cpus+0,,1"],
+             fails=True,
+             expect_filename="t/" + test.name + "__b.out")
+
+test.execute(all_run_flags=["+verilator+threads+cpus+0-4000000000"],
+             fails=True,
+             expect_filename="t/" + test.name + "__c.out")
+
+test.execute(all_run_flags=["+verilator+threads+cpus+3-1"],
+             fails=True,
+             expect_filename="t/" + test.name + "__d.out")
+
+test.passes()
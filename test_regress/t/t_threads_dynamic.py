@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_gen_alw.v"  # Any, as long as has a few mtasks
+
+# Reference waveform from a single-threaded model
+test.compile(verilator_flags2=['--cc --trace-vcd'], threads=1)
+test.execute()
+os.rename(test.trace_filename, test.obj_dir + "/threads1.vcd")
+
+test.compile(verilator_flags2=['--cc --trace-vcd --threads-dynamic --stats'], threads=4)
+
+# Default spin budget, and a tiny one so idle threads park between mtasks
+test.execute()
+test.vcd_identical(test.trace_filename, test.obj_dir + "/threads1.vcd")
+test.execute(all_run_flags=["+verilator+threads+spin+budget+1"])
+test.vcd_identical(test.trace_filename, test.obj_dir + "/threads1.vcd")
+
+test.file_grep(test.stats, r'Optimizations, Thread schedule dynamic tasks\s+(\d+)')
+
+test.passes()
@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.compile(verilator_flags2=["--exe --main --timing"])
+
+test.execute()
+
+# Processes of later rounds reuse the frames freed by earlier rounds
+match = test.file_grep(test.run_log_filename,
+                       r'coroutine frames (\d+); reused ([\d.]+)%; largest (\d+) bytes')
+if match:
+    frames, reused, largest = match[0]
+    if int(frames) < 200 * 32:
+        test.error("Too few coroutine frames: " + frames)
+    if float(reused) < 90:
+        test.error("Too few coroutine frames reused: " + reused + "%")
+
+test.passes()
@@ -0,0 +1,55 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+   localparam ROUNDS = 200;
+   localparam FORKS = 32;
+
+   int sum;
+   int finished;
+
+   // Processes with different frame sizes, so several size classes are reused
+   task automatic small(int i);
+      #(i % 3) sum += i;
+      finished++;
+   endtask
+
+   task automatic large(int i);
+      int vals[16];
+      foreach (vals[j]) vals[j] = i + j;
+      #((i % 5) + 1);
+      foreach (vals[j]) sum += vals[j];
+      finished++;
+   endtask
+
+   initial begin
+      int expected;
+      for (int round = 0; round < ROUNDS; ++round) begin
+         sum = 0;
+         finished = 0;
+         expected = 0;
+         for (int i = 0; i < FORKS; ++i) begin
+            fork
+               automatic int k = i + round;
+               if (k % 2) small(k);
+               else large(k);
+            join_none
+            expected += (((i + round) % 2) ? (i + round) : 16 * (i + round) + 120);
+         end
+         wait fork;
+         if (finished != FORKS) begin
+            $write("%%Error: round %0d finished %0d processes\n", round, finished);
+            $stop;
+         end
+         if (sum != expected) begin
+            $write("%%Error: round %0d sum %0d, expected %0d\n", round, sum, expected);
+            $stop;
+         end
+      end
+      $write("*-* All Finished *-*\n");
+      $finish;
+   end
+endmodule
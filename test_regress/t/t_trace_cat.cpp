@@ -39,6 +39,11 @@ int main(int argc, char** argv) {
     // Test for traceCapable - randomly-ish selected this test
     TEST_CHECK_EQ(top->traceCapable, true);
 
+#if defined(T_TRACE_CAT_ASYNC)
+    tfp->asyncWrite(true);
+#elif defined(T_TRACE_CAT_INDEX)
+    tfp->indexInterval(50);
+#endif
     tfp->open(trace_name());
 
     top->clk = 0;
@@ -48,7 +53,7 @@ int main(int argc, char** argv) {
         top->eval();
 
         if ((main_time % 100) == 0) {
-#if defined(T_TRACE_CAT)
+#if defined(T_TRACE_CAT) || defined(T_TRACE_CAT_ASYNC) || defined(T_TRACE_CAT_INDEX)
             tfp->openNext(true);
 #elif defined(T_TRACE_CAT_REOPEN)
             tfp->close();
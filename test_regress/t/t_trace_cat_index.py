@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+test.pli_filename = "t/t_trace_cat.cpp"
+test.top_filename = "t/t_trace_cat.v"
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             v_flags2=["--trace-vcd --exe", test.pli_filename])
+
+test.execute()
+
+
+def check_index(filename, expTimes):
+    with open(filename, 'rb') as fh:
+        data = fh.read()
+    times = []
+    with open(filename + ".idx", 'r', encoding="utf8") as fh:
+        for line in fh:
+            (offset, time) = line.split()
+            stamp = data[int(offset):data.index(b'\n', int(offset))]
+            if stamp != ("#" + time).encode():
+                test.error(filename + ": index entry '" + line.strip() + "' points to '" +
+                           stamp.decode() + "'")
+            times.append(int(time))
+    if times != expTimes:
+        test.error(filename + ": index times " + str(times) + " expected " + str(expTimes))
+
+
+# Checkpoints every 50 time units, and at the start of each file
+check_index(test.obj_dir + "/simpart_0000.vcd", [])
+check_index(test.obj_dir + "/simpart_0000_cat0000.vcd", [0, 50])
+check_index(test.obj_dir + "/simpart_0000_cat0001.vcd", [100, 150])
+
+test.passes()
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+test.compile(v_flags2=["--trace-saif"])
+
+test.execute()
+
+# Toggle count of each traced bit
+tcs = {}
+with open(test.trace_filename, 'r', encoding="utf8") as fh:
+    for line in fh:
+        m = re.search(r'\((\w+)\\\[(\d+)\\\] .*\(TC (\d+)\)', line)
+        if m:
+            tcs[(m.group(1), int(m.group(2)))] = int(m.group(3))
+
+# Every bit of the inverted signals toggles equally, and none past the width exist
+for name, width in (("w3", 3), ("w65", 65), ("w70", 70), ("w100", 100), ("w130", 130)):
+    counts = [tcs.get((name, i)) for i in range(width)]
+    if None in counts:
+        test.error(name + " is missing bit " + str(counts.index(None)))
+    if (name, width) in tcs:
+        test.error(name + " has a bit past its width")
+    if len(set(counts)) != 1 or counts[0] == 0:
+        test.error(name + " bits toggled unequally: " + str(counts))
+
+# Only the top bit of h100 toggles
+for i in range(100):
+    if (tcs.get(("h100", i)) != 0) != (i == 99):
+        test.error("h100[" + str(i) + "] has unexpected toggle count " + str(tcs.get(("h100", i))))
+
+test.passes()
@@ -0,0 +1,38 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+
+   // Widths that are not a multiple of 64, see t_trace_saif_wide.py
+   logic [2:0] w3 = 0;
+   logic [64:0] w65 = 0;
+   logic [69:0] w70 = 0;
+   logic [99:0] w100 = 0;
+   logic [129:0] w130 = 0;
+   logic [99:0] h100 = 0;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc < 10) begin
+         w3 <= ~w3;
+         w65 <= ~w65;
+         w70 <= ~w70;
+         w100 <= ~w100;
+         w130 <= ~w130;
+         h100[99] <= ~h100[99];
+      end
+      if (cyc == 20) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
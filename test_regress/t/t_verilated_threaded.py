@@ -19,6 +19,7 @@ test.compile(
     verilator_flags2=[
         "--cc --coverage-toggle --coverage-line --coverage-user --trace-vcd --vpi",
         root + "/include/verilated_save.cpp",
+        root + "/include/verilated_fork.cpp",
         ("--timing" if test.have_coroutines else "--no-timing -Wno-STMTDLY")
     ],
     threads=1)
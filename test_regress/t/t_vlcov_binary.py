@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('dist')
+test.golden_filename = "t/t_vlcov_merge.out"
+
+# Convert each text file to binary
+for name in ("a", "b", "c", "d"):
+    test.run(cmd=[
+        os.environ["VERILATOR_ROOT"] + "/bin/verilator_coverage",
+        "--write-binary",
+        test.obj_dir + "/coverage_" + name + ".datb",
+        "t/t_vlcov_data_" + name + ".dat",
+    ],
+             verilator_run=True)
+
+# Merge binary files
+test.run(cmd=[
+    os.environ["VERILATOR_ROOT"] + "/bin/verilator_coverage",
+    "--write",
+    test.obj_dir + "/coverage.dat",
+    test.obj_dir + "/coverage_a.datb",
+    test.obj_dir + "/coverage_b.datb",
+    test.obj_dir + "/coverage_c.datb",
+    test.obj_dir + "/coverage_d.datb",
+],
+         verilator_run=True)
+
+test.files_identical_sorted(test.obj_dir + "/coverage.dat", test.golden_filename)
+
+test.passes()
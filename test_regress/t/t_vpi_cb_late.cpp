@@ -0,0 +1,114 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+// cbValueChange callbacks registered on an already watched signal, after it
+// changed but before the value change callbacks were called, must only see
+// changes from their own registration on.
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include "vpi_user.h"
+
+#include <cstring>
+#include <iostream>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+#include "TestSimulator.h"
+#include "TestVpi.h"
+
+int errors = 0;
+
+enum { CB_A, CB_B, CB_C, N_CBS };
+int counts[N_CBS] = {0};
+const char* const names[N_CBS] = {"a", "b", "c"};
+
+static int the_callback(p_cb_data cb_data) {
+    ++counts[*reinterpret_cast<int*>(cb_data->user_data)];
+    return 0;
+}
+
+static vpiHandle register_cb(int* indexp) {
+    TestVpiHandle vh = VPI_HANDLE("value");
+    TEST_CHECK_NZ(vh);
+    s_vpi_value v;
+    v.format = vpiSuppressVal;
+    t_cb_data cb_data;
+    bzero(&cb_data, sizeof(cb_data));
+    cb_data.reason = cbValueChange;
+    cb_data.cb_rtn = the_callback;
+    cb_data.obj = vh;
+    cb_data.value = &v;
+    cb_data.user_data = reinterpret_cast<PLI_BYTE8*>(indexp);
+    if (verbose) vpi_printf(const_cast<char*>("- Registering callback %s\n"), names[*indexp]);
+    return vpi_register_cb(&cb_data);
+}
+
+static void put(int value) {
+    TestVpiHandle vh = VPI_HANDLE("value");
+    s_vpi_value v;
+    v.format = vpiIntVal;
+    v.value.integer = value;
+    vpi_put_value(vh, &v, nullptr, vpiNoDelay);
+}
+
+static void check(int line, int expA, int expB, int expC) {
+    VerilatedVpi::callValueCbs();
+    if (verbose) {
+        vpi_printf(const_cast<char*>("- Line %d counts a=%d b=%d c=%d\n"), line, counts[CB_A],
+                   counts[CB_B], counts[CB_C]);
+    }
+    TEST_CHECK_EQ(counts[CB_A], expA);
+    TEST_CHECK_EQ(counts[CB_B], expB);
+    TEST_CHECK_EQ(counts[CB_C], expC);
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(),
+                                                        // Note null name - we're flattening it out
+                                                        ""}};
+    topp->eval();
+
+    int indexes[N_CBS] = {CB_A, CB_B, CB_C};
+    TestVpiHandle vh_a = register_cb(&indexes[CB_A]);
+    check(__LINE__, 0, 0, 0);
+
+    // Change, then add a callback before calling: only the first sees the change
+    put(1);
+    TestVpiHandle vh_b = register_cb(&indexes[CB_B]);
+    check(__LINE__, 1, 0, 0);
+    check(__LINE__, 1, 0, 0);
+
+    // Both see the next change
+    put(2);
+    check(__LINE__, 2, 1, 0);
+
+    // Added at 3, then back to 2, which only the new callback sees as a change
+    put(3);
+    TestVpiHandle vh_c = register_cb(&indexes[CB_C]);
+    put(2);
+    check(__LINE__, 2, 1, 1);
+
+    // All see the next change
+    put(4);
+    check(__LINE__, 3, 2, 2);
+    check(__LINE__, 3, 2, 2);
+
+    topp->final();
+    if (errors) return 10;
+    VL_PRINTF("*-* All Finished *-*\n");
+    return 0;
+}
@@ -0,0 +1,19 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   input clk
+   );
+
+   // Only written through VPI
+   reg [31:0]     value    /*verilator public_flat_rw */;
+
+   initial begin
+      value = 0;
+   end
+
+endmodule : t
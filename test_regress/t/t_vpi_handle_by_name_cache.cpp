@@ -0,0 +1,89 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+// vpi_handle_by_name returns the same handle for the same name, which stays
+// valid after vpi_release_handle, and is looked up again after the model is
+// deleted and created again.
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include "vpi_user.h"
+
+#include <cstring>
+#include <iostream>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+#include "TestSimulator.h"
+#include "TestVpi.h"
+
+int errors = 0;
+
+static void check_value(vpiHandle vh, int exp) {
+    TEST_CHECK_NZ(vh);
+    if (!vh) return;
+    TEST_CHECK_CSTR(vpi_get_str(vpiFullName, vh), TestSimulator::rooted("value"));
+    TEST_CHECK_EQ(vpi_get(vpiSize, vh), 32);
+    s_vpi_value v;
+    v.format = vpiIntVal;
+    vpi_get_value(vh, &v);
+    TEST_CHECK_EQ(v.value.integer, exp);
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(),
+                                                  // Note null name - we're flattening it out
+                                                  ""}};
+    topp->eval();
+
+    // Repeated lookups, also relative to a scope, give the same handle
+    vpiHandle const vh1 = VPI_HANDLE("value");
+    check_value(vh1, 1234);
+    vpiHandle const vh2 = VPI_HANDLE("value");
+    TEST_CHECK_EQ(vh1, vh2);
+    vpiHandle const scopeh = VPI_HANDLE("");
+    TEST_CHECK_NZ(scopeh);
+    vpiHandle const vh3 = vpi_handle_by_name(const_cast<PLI_BYTE8*>("value"), scopeh);
+    TEST_CHECK_EQ(vh1, vh3);
+    TEST_CHECK_EQ(vpi_release_handle(scopeh), 1);
+
+    // Released handles stay valid, and are returned again
+    TEST_CHECK_EQ(vpi_release_handle(vh1), 1);
+    check_value(vh2, 1234);
+    vpiHandle const vh4 = VPI_HANDLE("value");
+    TEST_CHECK_EQ(vh1, vh4);
+    check_value(vh4, 1234);
+
+    // Handles to a deleted model are not returned for the new model
+    s_vpi_value v;
+    v.format = vpiIntVal;
+    v.value.integer = 5678;
+    vpi_put_value(vh4, &v, nullptr, vpiNoDelay);
+    check_value(vh4, 5678);
+    topp->final();
+    topp.reset();
+    topp.reset(new VM_PREFIX{contextp.get(), ""});
+    topp->eval();
+    vpiHandle const vh5 = VPI_HANDLE("value");
+    check_value(vh5, 1234);
+    vpiHandle const vh6 = VPI_HANDLE("value");
+    TEST_CHECK_EQ(vh5, vh6);
+
+    topp->final();
+    if (errors) return 10;
+    VL_PRINTF("*-* All Finished *-*\n");
+    return 0;
+}
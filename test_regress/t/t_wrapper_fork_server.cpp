@@ -0,0 +1,74 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module for VerilatedForkServer
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_cov.h>
+#include <verilated_fork.h>
+#include <verilated_vcd_c.h>
+
+#include <memory>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+int errors = 0;
+
+static void cycle(VerilatedContext* contextp, VM_PREFIX* topp, VerilatedVcdC* tfp) {
+    for (int i = 0; i < 2; ++i) {
+        contextp->timeInc(5);
+        topp->clk = !topp->clk;
+        topp->eval();
+        tfp->dump(contextp->time());
+    }
+}
+
+int main(int argc, char** argv) {
+    // Unbuffered, so output before a fork is not repeated by the children
+    setvbuf(stdout, nullptr, _IONBF, 0);
+
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+    contextp->traceEverOn(true);
+    contextp->coverageFilename(VL_STRINGIFY(TEST_OBJ_DIR) "/coverage.dat");
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), "top"}};
+    const std::unique_ptr<VerilatedVcdC> tfp{new VerilatedVcdC};
+    topp->trace(tfp.get(), 99);
+    tfp->open(VL_STRINGIFY(TEST_OBJ_DIR) "/simx.vcd");
+
+    // Warm-up common to all children
+    topp->clk = 0;
+    topp->mode = 0;
+    topp->eval();
+    for (int i = 0; i < 10; ++i) cycle(contextp.get(), topp.get(), tfp.get());
+
+    VerilatedForkServer server{contextp.get()};
+    server.addModel(topp.get());
+    server.addTrace(tfp.get(), VL_STRINGIFY(TEST_OBJ_DIR) "/simx.vcd");
+    server.addCoverage(contextp->coveragep());
+    server.maxChildren(2);
+    for (unsigned child = 0; child < 3; ++child) {
+        if (server.fork(child)) {
+            topp->mode = child;
+            while (!contextp->gotFinish()) cycle(contextp.get(), topp.get(), tfp.get());
+            topp->final();
+            tfp->close();
+            contextp->coveragep()->write();
+            return errors ? 10 : 0;
+        }
+    }
+    TEST_CHECK_EQ(server.wait(), 0U);
+
+    // Parent holds the warm-up trace and coverage only
+    TEST_CHECK_EQ(tfp->isOpen(), false);
+    contextp->coveragep()->write();
+    return errors ? 10 : 0;
+}
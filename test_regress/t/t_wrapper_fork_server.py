@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt_all')
+
+root = ".."
+
+test.compile(make_main=False,
+             verilator_flags2=[
+                 "--exe", test.pli_filename, "--trace-vcd --coverage-line",
+                 root + "/include/verilated_fork.cpp"
+             ],
+             threads=(2 if test.vltmt else 1))
+
+test.execute()
+
+for child in range(3):
+    test.file_grep(test.run_log_filename, r'mode ' + str(child) + r' done, sum=' + str(child * 10))
+    if not os.path.exists(test.obj_dir + "/simx_" + str(child) + ".vcd"):
+        test.error("Child trace not created: simx_" + str(child) + ".vcd")
+    if not os.path.exists(test.obj_dir + "/coverage_" + str(child) + ".dat"):
+        test.error("Child coverage not created: coverage_" + str(child) + ".dat")
+
+# Parent's trace was closed at the first fork, after 10 warm-up cycles
+test.file_grep(test.obj_dir + "/simx.vcd", r'^#100$')
+test.file_grep_not(test.obj_dir + "/simx.vcd", r'^#105$')
+
+test.passes()
@@ -0,0 +1,31 @@
+// DESCRIPTION: Verilator: Verilog Test module for VerilatedForkServer
+//
+// Counts through a warm-up, after which the C++ forks a child process for
+// each mode, and each child runs its own continuation to $finish.
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk, mode
+   );
+   input clk;
+   input [1:0] mode;
+
+   integer cyc = 0;
+   integer sum = 0;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      sum <= sum + 32'(mode);
+      if (cyc == 20) begin
+         if (mode == 2'd0) $display("[%0t] mode 0 done, sum=%0d", $time, sum);
+         else if (mode == 2'd1) $display("[%0t] mode 1 done, sum=%0d", $time, sum);
+         else $display("[%0t] mode 2 done, sum=%0d", $time, sum);
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule